@@ -41,6 +41,22 @@ class Kainure_Core extends Event_Emitter {
         this.call_public = null;
         this.native = {};
         this.signatures = new Map();
+
+        this.on('newListener', (event_name) => this.Sync_Public(event_name, 1));
+        this.on('removeListener', (event_name) => this.Sync_Public(event_name, 0));
+    }
+
+    Sync_Public(event_name, pending) {
+        if (typeof event_name !== 'string' || event_name === 'newListener' || event_name === 'removeListener')
+            return;
+
+        if (globalThis.Kainure_Register_Public)
+            globalThis.Kainure_Register_Public(event_name, this.signatures.get(event_name) || '', this.listenerCount(event_name) + pending);
+    }
+
+    Sync_Publics() {
+        for (const event_name of this.eventNames())
+            this.Sync_Public(event_name, 0);
     }
 
     Public(event_name, ...args) {
@@ -73,14 +89,8 @@ class Kainure_Core extends Event_Emitter {
 const kainure = new Kainure_Core();
 globalThis.Kainure = kainure;
 
-globalThis.Float = (value) => {
-    const num = typeof value === 'number' ? value : Number(value);
-
-    if (Number.isInteger(num))
-        return num + 1e-10;
-
-    return num;
-};
+// Boxed, so an integral value still reaches natives without a signature and Call_Public as a float. Arithmetic unboxes it as usual.
+globalThis.Float = (value) => new Number(value);
 
 globalThis.Ref = (initial_value = 0) => ({
     value: initial_value,
@@ -104,25 +114,37 @@ globalThis.Public = (event_name, ...args) => {
     kainure.Public(event_name, ...args);
 };
 
-globalThis.Call_Public = new Proxy({}, {
-    get(_, prop) {
-        return (...args) => {
-            if (!kainure.call_public)
-                throw new Error('"call_public" not initialized by C++ yet.');
+globalThis.Call_Public = Object.create(new Proxy(Object.create(null), {
+    get(_, prop, receiver) {
+        if (typeof prop === 'symbol')
+            return undefined;
 
-            return kainure.call_public(String(prop), ...args);
-        };
+        if (!kainure.bind_public) {
+            return (...args) => {
+                if (!kainure.call_public)
+                    throw new Error('"call_public" not initialized by C++ yet.');
+
+                return kainure.call_public(prop, ...args);
+            };
+        }
+
+        const caller = kainure.bind_public(prop);
+        Object.defineProperty(receiver, prop, { value: caller, enumerable: true });
+
+        return caller;
     }
-});
+}));
 
-globalThis.Native = new Proxy(kainure.native, {
-    get(target, prop) {
+Object.setPrototypeOf(kainure.native, new Proxy(Object.prototype, {
+    get(target, prop, receiver) {
         if (Reflect.has(target, prop))
-            return Reflect.get(target, prop);
+            return Reflect.get(target, prop, receiver);
 
         throw new ReferenceError(`The native '${String(prop)}' was not found.`);
     }
-});
+}));
+
+globalThis.Native = kainure.native;
 
 globalThis.Native_Hook = (native_name, callback) => {
     if (typeof native_name !== 'string' || typeof callback !== 'function')
@@ -134,6 +156,167 @@ globalThis.Native_Hook = (native_name, callback) => {
         throw new Error("Native Hook system not initialized.");
 };
 
+class Native_Batch {
+    constructor(capacity = 64) {
+        const size = Math.max(1, capacity | 0);
+
+        this.count = 0;
+        this.arg_count = 0;
+        this.names = [];
+        this.ops = new Int32Array(size * 2);
+        this.args = new Float64Array(size * 4);
+        this.results = new Float64Array(size);
+    }
+
+    static Resolve(native_name) {
+        let id = Native_Batch.ids.get(native_name);
+
+        if (id === undefined) {
+            id = globalThis.Kainure_Resolve_Native ? globalThis.Kainure_Resolve_Native(native_name) : -1;
+
+            if (id === -1)
+                throw new ReferenceError(`The native '${native_name}' was not found.`);
+
+            if (id === -2)
+                throw new TypeError(`The native '${native_name}' takes strings or references, or has no known signature, and cannot be batched.`);
+
+            Native_Batch.ids.set(native_name, id);
+        }
+
+        return id;
+    }
+
+    get length() {
+        return this.count;
+    }
+
+    Add(native_name, ...args) {
+        const id = Native_Batch.Resolve(String(native_name));
+
+        // Values wrapped by 'Float()' are boxed Numbers and are unwrapped like plain ones.
+        if (!args.every((arg) => typeof arg === 'number' || typeof arg === 'boolean' || arg instanceof Number))
+            throw new TypeError(`Native_Batch: '${native_name}' received a non-numeric argument.`);
+
+        if (this.count === this.results.length) {
+            const ops = new Int32Array(this.ops.length * 2);
+            const results = new Float64Array(this.results.length * 2);
+
+            ops.set(this.ops);
+            this.ops = ops;
+            this.results = results;
+        }
+
+        if (this.arg_count + args.length > this.args.length) {
+            const grown = new Float64Array(Math.max(this.args.length * 2, this.arg_count + args.length));
+
+            grown.set(this.args);
+            this.args = grown;
+        }
+
+        for (const arg of args)
+            this.args[this.arg_count++] = Number(arg);
+
+        this.ops[this.count * 2] = id;
+        this.ops[this.count * 2 + 1] = args.length;
+        this.names[this.count++] = native_name;
+
+        return this;
+    }
+
+    Execute() {
+        const count = this.count;
+        // Cleared even when a native throws, so the same entries are never executed twice.
+        try {
+            let executed = count > 0 ? globalThis.Kainure_Execute_Native_Batch(this.ops, this.args, this.results, count) : 0;
+
+            if (executed === -1) {
+                for (let i = 0, pos = 0; i < count; i++) {
+                    const argc = this.ops[i * 2 + 1];
+
+                    this.results[i] = Native[this.names[i]](...this.args.subarray(pos, pos + argc));
+                    pos += argc;
+                }
+
+                executed = count;
+            }
+
+            return this.results.slice(0, executed);
+        }
+        finally {
+            this.Clear();
+        }
+    }
+
+    Clear() {
+        this.count = 0;
+        this.arg_count = 0;
+        this.names.length = 0;
+    }
+}
+
+Native_Batch.ids = new Map();
+
+globalThis.Native_Batch = Native_Batch;
+
+const deferred_queue = [];
+let deferred_head = 0;
+let deferred_carried = 0;
+let deferred_counted = 0;
+
+globalThis.Defer = (callback, ...args) => {
+    if (typeof callback !== 'function')
+        throw new Error("Usage: Defer(function, ...args)");
+
+    deferred_queue.push(args.length > 0 ? () => callback(...args) : callback);
+
+    if (globalThis.Kainure_Request_Deferred)
+        globalThis.Kainure_Request_Deferred();
+};
+
+globalThis.Tick_Stats = () => ({
+    pending: deferred_queue.length - deferred_head,
+    deferred: deferred_carried,
+    overruns: globalThis.Kainure_Get_Tick_Overruns ? globalThis.Kainure_Get_Tick_Overruns() : 0
+});
+
+globalThis.Kainure_Run_Deferred = (budget_ms) => {
+    const deadline = budget_ms < 0 ? Infinity : performance.now() + budget_ms;
+    const start = deferred_head;
+    const end = deferred_queue.length;
+
+    // At least one callback runs per tick, so an exhausted budget still makes progress.
+    while (deferred_head < end && (deferred_head === start || performance.now() < deadline)) {
+        const callback = deferred_queue[deferred_head];
+
+        deferred_queue[deferred_head++] = undefined;
+
+        // Caught per callback, so one failure neither drops the rest of the batch nor stalls the queue.
+        try {
+            callback();
+        }
+        catch (error) {
+            console.error(`Defer | Deferred callback threw: ${error && error.stack ? error.stack : error}`);
+        }
+    }
+
+    // Only callbacks that were due this tick and never missed one before are counted, so a backlog is not counted again every tick.
+    deferred_carried += Math.max(0, end - Math.max(deferred_head, deferred_counted));
+    deferred_counted = end;
+
+    if (deferred_head === deferred_queue.length) {
+        deferred_queue.length = 0;
+        deferred_head = 0;
+        deferred_counted = 0;
+    }
+    else if (deferred_head * 2 > deferred_queue.length) {
+        deferred_queue.splice(0, deferred_head);
+        deferred_counted -= deferred_head;
+        deferred_head = 0;
+    }
+
+    return deferred_queue.length - deferred_head;
+};
+
 globalThis.Include_Storage = (folder_name) => {
     if (typeof folder_name !== 'string' || folder_name.trim().length === 0)
         throw new Error("Include_Storage: 'folder_name' must be a non-empty string.");
@@ -175,12 +358,12 @@ globalThis.Kainure_Emit_Event = (name, ...args) => {
     return last_result;
 };
 
-globalThis.Kainure_Has_Listeners = (name) => {
-    return kainure.listenerCount(name) > 0;
+globalThis.Kainure_Get_Listeners = (name) => {
+    return kainure.rawListeners(name);
 };
 
-globalThis.Kainure_Get_Signature = (name) => {
-    return kainure.signatures.get(name) || "";
+globalThis.Kainure_Has_Listeners = (name) => {
+    return kainure.listenerCount(name) > 0;
 };
 
 module.exports = kainure;
\ No newline at end of file
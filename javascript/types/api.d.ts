@@ -50,4 +50,20 @@ declare const Native: {
 };
 
 declare function Native_Hook(native_name: string, callback: (...args: any[]) => void): void;
+
+declare class Native_Batch {
+    constructor(capacity?: number);
+    readonly length: number;
+    Add(native_name: string, ...args: (number | boolean)[]): this;
+    Execute(): Float64Array;
+    Clear(): void;
+}
+
+declare function Defer(callback: (...args: any[]) => void, ...args: any[]): void;
+
+declare function Tick_Stats(): {
+    pending: number;
+    deferred: number;
+    overruns: number;
+};
 declare function Include_Storage(include_name: string): string;
\ No newline at end of file
@@ -0,0 +1,63 @@
+/* ============================================================================ *
+ * Kainure - Node.js Framework for SA-MP (San Andreas Multiplayer)              *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * Kainure embeds Node.js runtime into SA-MP servers, enabling developers       *
+ * to write gamemodes using modern JavaScript/TypeScript with full access       *
+ * to the Node.js ecosystem, async/await, npm packages, and native SA-MP        *
+ * functions through automatic bindings.                                        *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/kainure                          *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the Apache License, Version 2.0 (the "License");              *
+ * you may not use this file except in compliance with the License.             *
+ * You may obtain a copy of the License at:                                     *
+ *                                                                              *
+ *     http://www.apache.org/licenses/LICENSE-2.0                               *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include "sdk/amx/amx_api.hpp"
+//
+#include "amx_arena.hpp"
+#include "constants.hpp"
+
+Amx_Arena::Amx_Arena(AMX* amx) : amx_(amx), heap_mark_(amx ? amx->hea : 0) {}
+
+Amx_Arena::~Amx_Arena() {
+    if (amx_)
+        amx_->hea = heap_mark_;
+}
+
+bool Amx_Arena::Allocate(AMX* amx, size_t cells, cell& amx_addr, cell*& phys_addr) {
+    if (!amx || cells == 0)
+        return false;
+
+    cell bytes = static_cast<cell>(cells * sizeof(cell));
+    cell margin = static_cast<cell>(Constants::AMX_STACK_MARGIN_CELLS * sizeof(cell));
+
+    if (amx->stk - amx->hea - bytes < margin)
+        return false;
+
+    amx_addr = amx->hea;
+    amx->hea += bytes;
+
+    if (Samp_SDK::amx::Get_Addr(amx, amx_addr, &phys_addr) != static_cast<int>(Amx_Error::None) || !phys_addr)
+        return (amx->hea = amx_addr, false);
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+/* ============================================================================ *
+ * Kainure - Node.js Framework for SA-MP (San Andreas Multiplayer)              *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * Kainure embeds Node.js runtime into SA-MP servers, enabling developers       *
+ * to write gamemodes using modern JavaScript/TypeScript with full access       *
+ * to the Node.js ecosystem, async/await, npm packages, and native SA-MP        *
+ * functions through automatic bindings.                                        *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/kainure                          *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the Apache License, Version 2.0 (the "License");              *
+ * you may not use this file except in compliance with the License.             *
+ * You may obtain a copy of the License at:                                     *
+ *                                                                              *
+ *     http://www.apache.org/licenses/LICENSE-2.0                               *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <cstddef>
+//
+#include "sdk/amx/amx_defs.h"
+
+class Amx_Arena {
+    public:
+        explicit Amx_Arena(AMX* amx);
+        ~Amx_Arena();
+
+        static bool Allocate(AMX* amx, size_t cells, cell& amx_addr, cell*& phys_addr);
+
+    private:
+        Amx_Arena(const Amx_Arena&) = delete;
+        Amx_Arena& operator=(const Amx_Arena&) = delete;
+
+        AMX* amx_;
+        cell heap_mark_;
+};
\ No newline at end of file
@@ -38,6 +38,7 @@
 #include <string_view>
 //
 #include "code_preprocessor.hpp"
+#include "native_signatures.hpp"
 #include "logger.hpp"
 
 namespace {
@@ -306,12 +307,22 @@ std::string Code_Preprocessor::Transform_Native_Calls(const std::string& code) {
                                 ++scan;
 
                             if (scan < len && Is_Identifier_Start(code[scan])) {
+                                size_t name_start = scan;
+
                                 while (scan < len && Is_Identifier_Char(code[scan]))
                                     ++scan;
 
+                                std::string_view native_name = std::string_view(code).substr(name_start, scan - name_start);
+
                                 while (scan < len && std::isspace(static_cast<unsigned char>(code[scan])))
                                     ++scan;
 
+                                if (scan < len && code[scan] == '(' && Native_Signatures::Find(native_name)) {
+                                    i = scan;
+
+                                    continue;
+                                }
+
                                 if (scan < len && code[scan] == '(') {
                                     state = Parse_State::In_Native_Call;
 
@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace Constants {
     // Directories
     constexpr const char* DIR_ROOT = "Kainure";
@@ -39,6 +42,8 @@ namespace Constants {
     constexpr const char* DIR_TYPES = "Kainure/types";
     constexpr const char* DIR_INCLUDES = "Kainure/includes";
     constexpr const char* DIR_INCLUDES_STORAGE = "Kainure/includes_storage";
+    constexpr const char* DIR_CODE_CACHE = "Kainure/code_cache";
+    constexpr const char* DIR_TS_CACHE = "Kainure/ts_cache";
 
     // Files
     constexpr const char* FILE_ERROR_LOG = "Kainure/errors.log";
@@ -46,30 +51,51 @@ namespace Constants {
     constexpr const char* FILE_FRAMEWORK = "./Kainure/kainure.js";
     constexpr const char* FILE_BOOTSTRAP = "bootstrap.js";
     constexpr const char* FILE_TSCONFIG = "tsconfig.json";
+    constexpr const char* FILE_STARTUP_SNAPSHOT = "Kainure/kainure.snapshot";
+    constexpr const char* FILE_STARTUP_SNAPSHOT_FAILED = "Kainure/kainure.snapshot.failed";
+    constexpr const char* FILE_SNAPSHOT_BUILDER = "snapshot_builder.js";
+    constexpr const char* FILE_CODE_CACHE_SETUP = "code_cache.js";
+
+    // Framework core modules preloaded into the startup snapshot, in 'kainure.js' order
+    constexpr const char* SNAPSHOT_CORE_MODULES[] = {
+        "./Kainure/core/api.js",
+        "./Kainure/core/commands.js",
+        "./Kainure/core/samp_constants.js",
+        "./Kainure/core/warnings.js"
+    };
 
     // Default paths
     constexpr const char* DEFAULT_MAIN_FILE = "./main.js";
     constexpr const char* DEFAULT_TS_OUT_DIR = "./dist";
 
     // Names of global JavaScript functions
-    constexpr const char* JS_EMIT_EVENT = "Kainure_Emit_Event";
-    constexpr const char* JS_HAS_LISTENERS = "Kainure_Has_Listeners";
-    constexpr const char* JS_GET_SIGNATURE = "Kainure_Get_Signature";
+    constexpr const char* JS_GET_LISTENERS = "Kainure_Get_Listeners";
+    constexpr const char* JS_REGISTER_PUBLIC = "Kainure_Register_Public";
     constexpr const char* JS_REGISTER_NATIVE_HOOK = "Kainure_Register_Native_Hook";
+    constexpr const char* JS_RESOLVE_NATIVE = "Kainure_Resolve_Native";
+    constexpr const char* JS_EXECUTE_NATIVE_BATCH = "Kainure_Execute_Native_Batch";
     constexpr const char* JS_KAINURE_OBJECT = "Kainure";
     constexpr const char* JS_NATIVE_OBJECT = "native";
     constexpr const char* JS_CALL_PUBLIC_OBJECT = "call_public";
+    constexpr const char* JS_BIND_PUBLIC_OBJECT = "bind_public";
     constexpr const char* JS_CONSOLE_OBJECT = "console";
     constexpr const char* JS_PREPROCESS_FUNCTION = "Kainure_Preprocess";
+    constexpr const char* JS_RUN_DEFERRED = "Kainure_Run_Deferred";
+    constexpr const char* JS_REQUEST_DEFERRED = "Kainure_Request_Deferred";
+    constexpr const char* JS_GET_TICK_OVERRUNS = "Kainure_Get_Tick_Overruns";
+    constexpr const char* JS_REPORT_TYPE_CHECK = "Kainure_Report_Type_Check";
 
     // V8/Node.js settings
     constexpr const char* PROCESS_NAME = "Kainure.dll";
     constexpr int V8_PLATFORM_THREADS = 4;
+    constexpr int V8_MAX_PLATFORM_THREADS = 64;
+    constexpr double DEFAULT_TICK_BUDGET_MS = 2.0;
 
     // Buffer sizes
     constexpr size_t DEFAULT_STRING_BUFFER_SIZE = 512;
     constexpr size_t LOG_BUFFER_SIZE = 2048;
     constexpr size_t AMX_SANDBOX_SIZE = 64 * 1024;
+    constexpr size_t AMX_STACK_MARGIN_CELLS = 16;
 
     // Special events
     constexpr const char* EVENT_GAMEMODE_INIT = "OnGameModeInit";
@@ -93,6 +119,22 @@ namespace Constants {
     constexpr const char* CONFIG_KEY_TYPESCRIPT = "typescript";
     constexpr const char* CONFIG_KEY_TS_ENABLED = "enabled";
     constexpr const char* CONFIG_KEY_TS_OUT_DIR = "output_dir";
+    constexpr const char* CONFIG_KEY_TS_MODE = "mode";
+    constexpr const char* CONFIG_KEY_TS_BACKGROUND_CHECK = "background_type_check";
+
+    constexpr const char* CONFIG_KEY_RUNTIME = "runtime";
+    constexpr const char* CONFIG_KEY_PLATFORM_THREADS = "platform_threads";
+    constexpr const char* CONFIG_KEY_CPU_AFFINITY = "cpu_affinity";
+    constexpr const char* CONFIG_KEY_TICK_BUDGET = "tick_budget_ms";
+    constexpr const char* CONFIG_KEY_STARTUP_SNAPSHOT = "startup_snapshot";
+    constexpr const char* CONFIG_KEY_CODE_CACHE = "code_cache";
+
+    constexpr const char* CONFIG_KEY_V8 = "v8";
+    constexpr const char* CONFIG_KEY_V8_MAX_OLD_SPACE = "max_old_space_size";
+    constexpr const char* CONFIG_KEY_V8_INITIAL_OLD_SPACE = "initial_old_space_size";
+    constexpr const char* CONFIG_KEY_V8_MAX_SEMI_SPACE = "max_semi_space_size";
+    constexpr const char* CONFIG_KEY_V8_EXPOSE_GC = "expose_gc";
+    constexpr const char* CONFIG_KEY_V8_FLAGS = "flags";
 
     // Console methods
     constexpr const char* CONSOLE_LOG = "log";
@@ -110,8 +152,17 @@ namespace Constants {
     constexpr const char* TS_CHECK_SCRIPT_NAME = "ts_check.js";
     constexpr const char* TS_INSTALL_SCRIPT_NAME = "ts_install.js";
     constexpr const char* TS_COMPILER_SCRIPT_NAME = "ts_compiler.js";
+    constexpr const char* TS_TYPE_CHECK_SCRIPT_NAME = "ts_type_check.js";
+    constexpr const char* TS_REQUIRE_HOOK_SCRIPT_NAME = "ts_require_hook.js";
+    constexpr const char* TS_BUILD_INFO_FILE = "kainure.tsbuildinfo";
+    constexpr const char* TS_CHECK_BUILD_INFO_FILE = "kainure.check.tsbuildinfo";
+    constexpr const char* TS_TRANSPILE_STAMP_FILE = "kainure.transpile.stamp";
+    constexpr const char* TS_MODE_CHECK = "check";
+    constexpr const char* TS_MODE_TRANSPILE = "transpile";
+    constexpr const char* TS_MODE_ON_DEMAND = "on_demand";
     constexpr const char* NPM_INSTALL_TYPESCRIPT = "npm install typescript";
     constexpr int NPM_INSTALL_TIMEOUT_MS = 120000;
+    constexpr int TS_CACHE_MAX_AGE_DAYS = 30;
 
     // TypeScript Config defaults
     constexpr const char* TSCONFIG_TARGET = "ES2020";
@@ -126,8 +177,12 @@ namespace Constants {
     constexpr char SIGNATURE_TYPE_BOOL = 'b';
     constexpr char SIGNATURE_TYPE_FLOAT = 'f';
     constexpr char SIGNATURE_TYPE_STRING = 's';
+    constexpr char SIGNATURE_TYPE_INT_REF = 'I';
+    constexpr char SIGNATURE_TYPE_FLOAT_REF = 'F';
+    constexpr char SIGNATURE_TYPE_STRING_REF = 'S';
 
     // Native function call optimization
     constexpr size_t STACK_ARGS_THRESHOLD = 32;
     constexpr size_t STACK_BUFFER_SIZE = STACK_ARGS_THRESHOLD + 1;
+    constexpr size_t FAST_API_MAX_ARGS = 16;
 }
\ No newline at end of file
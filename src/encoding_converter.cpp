@@ -31,11 +31,13 @@
  * ============================================================================ */
 
 #include <cstring>
+#include <algorithm>
 #include <cctype>
 #include <vector>
 //
 #include "encoding_converter.hpp"
 #include "constants.hpp"
+#include "simd.hpp"
 #include "logger.hpp"
 #include "exceptions.hpp"
 
@@ -47,6 +49,9 @@
 #endif
 
 namespace {
+    constexpr uint32_t UNMAPPED_CODE_POINT = 0xFFFFFFFF;
+    constexpr char REPLACEMENT_CHAR = '?';
+
     bool Is_Only_Digits(const std::string& str) {
         if (str.empty())
             return false;
@@ -58,6 +63,98 @@ namespace {
 
         return true;
     }
+
+    size_t Decode_UTF8(const unsigned char* str, size_t len, uint32_t& code_point) {
+        unsigned char lead = str[0];
+        size_t size = lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+
+        if (lead < 0xC2 || lead > 0xF4 || size > len)
+            return 0;
+
+        code_point = lead & (0xFF >> (size + 1));
+
+        for (size_t i = 1; i < size; i++) {
+            if ((str[i] & 0xC0) != 0x80)
+                return 0;
+
+            code_point = (code_point << 6) | (str[i] & 0x3F);
+        }
+
+        return size;
+    }
+
+    size_t Encode_UTF8(uint32_t code_point, char* out, size_t capacity) {
+        size_t size = code_point < 0x80 ? 1 : code_point < 0x800 ? 2 : code_point < 0x10000 ? 3 : 4;
+
+        if (size > capacity)
+            return 0;
+
+        if (size == 1)
+            out[0] = static_cast<char>(code_point);
+        else if (size == 2) {
+            out[0] = static_cast<char>(0xC0 | (code_point >> 6));
+            out[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+        else if (size == 3) {
+            out[0] = static_cast<char>(0xE0 | (code_point >> 12));
+            out[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+        else {
+            out[0] = static_cast<char>(0xF0 | (code_point >> 18));
+            out[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+            out[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            out[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+
+        return size;
+    }
+
+    size_t Copy_Bytes(std::string_view input, char* out_buffer, size_t buffer_size) {
+        size_t len = std::min(input.length(), buffer_size);
+
+        memcpy(out_buffer, input.data(), len);
+
+        return len;
+    }
+
+#if defined(_WIN32)
+    static thread_local std::wstring tl_utf16_buffer;
+#elif defined(__linux__)
+    const std::string UTF8_ENCODING = "UTF-8";
+
+    struct Iconv_Handle {
+        iconv_t cd = reinterpret_cast<iconv_t>(-1);
+        std::string from;
+        std::string to;
+
+        ~Iconv_Handle() {
+            if (cd != reinterpret_cast<iconv_t>(-1))
+                iconv_close(cd);
+        }
+    };
+
+    static thread_local Iconv_Handle tl_iconv_handles[2];
+
+    iconv_t Acquire_Iconv(const std::string& from_encoding, const std::string& to_encoding) {
+        Iconv_Handle& handle = tl_iconv_handles[from_encoding == UTF8_ENCODING ? 0 : 1];
+
+        if (handle.cd != reinterpret_cast<iconv_t>(-1) && handle.from == from_encoding && handle.to == to_encoding) {
+            iconv(handle.cd, nullptr, nullptr, nullptr, nullptr);
+
+            return handle.cd;
+        }
+
+        if (handle.cd != reinterpret_cast<iconv_t>(-1))
+            iconv_close(handle.cd);
+
+        handle.cd = iconv_open(to_encoding.c_str(), from_encoding.c_str());
+        handle.from = from_encoding;
+        handle.to = to_encoding;
+
+        return handle.cd;
+    }
+#endif
 }
 
 Encoding_Converter& Encoding_Converter::Instance() {
@@ -68,6 +165,8 @@ Encoding_Converter& Encoding_Converter::Instance() {
 
 void Encoding_Converter::Initialize(bool enabled, const std::string& target) {
     encoding_enabled_ = enabled;
+    single_byte_ = false;
+    ascii_compatible_ = false;
 
     if (!encoding_enabled_) {
         Logger::Log(Log_Level::INFO, "Encoding conversion disabled. Using UTF-8 passthrough.");
@@ -138,206 +237,303 @@ void Encoding_Converter::Initialize(bool enabled, const std::string& target) {
         }
 #endif
     }
-}
 
-std::string Encoding_Converter::UTF8_To_Target(const std::string& utf8_str) const {
-    if (!encoding_enabled_ || utf8_str.empty())
-        return utf8_str;
+    if (encoding_enabled_ && Build_Single_Byte_Tables()) {
+        single_byte_ = true;
 
-#if defined(_WIN32)
-    if (target_codepage_ == 65001)
-        return utf8_str;
+        Logger::Log(Log_Level::INFO, "Target encoding is single-byte. Using table-driven conversion.");
+    }
 
-    try {
-        std::wstring utf16 = UTF8_To_UTF16(utf8_str);
+    ascii_compatible_ = encoding_enabled_ && (single_byte_ || Probe_ASCII_Compatible());
+}
 
-        return UTF16_To_CodePage(utf16, target_codepage_);
-    }
-    catch (const Encoding_Exception& e) {
-        return (Logger::Log(Log_Level::ERROR_s, "UTF8_To_Target conversion failed: '%s'. Returning original string.", e.what()), utf8_str);
-    }
-#elif defined(__linux__)
-    if (target_encoding_ == "UTF-8")
-        return utf8_str;
+bool Encoding_Converter::Probe_ASCII_Compatible() const {
+    std::string ascii;
 
-    try {
-        return Iconv_Convert(utf8_str, "UTF-8", target_encoding_);
-    }
-    catch (const Encoding_Exception& e) {
-        return (Logger::Log(Log_Level::ERROR_s, "UTF8_To_Target conversion failed: '%s'. Returning original string.", e.what()), utf8_str);
-    }
-#endif
+    for (int c = 0x01; c < 0x80; c++)
+        ascii.push_back(static_cast<char>(c));
+
+    return UTF8_To_Target(ascii) == ascii && Target_To_UTF8(ascii) == ascii;
 }
 
-std::string Encoding_Converter::Target_To_UTF8(const std::string& target_str) const {
-    if (!encoding_enabled_ || target_str.empty())
-        return target_str;
+bool Encoding_Converter::Build_Single_Byte_Tables() {
+    byte_to_unicode_.fill(UNMAPPED_CODE_POINT);
 
 #if defined(_WIN32)
-    if (target_codepage_ == 65001)
-        return target_str;
+    CPINFO cp_info;
 
-    try {
-        std::wstring utf16 = CodePage_To_UTF16(target_str, target_codepage_);
-        
-        return UTF16_To_UTF8(utf16);
-    }
-    catch (const Encoding_Exception& e) {
-        return (Logger::Log(Log_Level::ERROR_s, "Target_To_UTF8 conversion failed: '%s'. Returning original string.", e.what()), target_str);
+    if (target_codepage_ == 65001 || !GetCPInfo(target_codepage_, &cp_info) || cp_info.MaxCharSize != 1)
+        return false;
+
+    for (int byte = 0; byte < 256; byte++) {
+        char input = static_cast<char>(byte);
+        wchar_t output = 0;
+
+        if (MultiByteToWideChar(target_codepage_, MB_ERR_INVALID_CHARS, &input, 1, &output, 1) == 1)
+            byte_to_unicode_[byte] = static_cast<uint32_t>(output);
     }
 #elif defined(__linux__)
-    if (target_encoding_ == "UTF-8")
-        return target_str;
+    iconv_t cd = iconv_open("UTF-32LE", target_encoding_.c_str());
 
-    try {
-        return Iconv_Convert(target_str, target_encoding_, "UTF-8");
-    }
-    catch (const Encoding_Exception& e) {
-        return (Logger::Log(Log_Level::ERROR_s, "Target_To_UTF8 conversion failed: '%s'. Returning original string.", e.what()), target_str);
+    if (cd == reinterpret_cast<iconv_t>(-1))
+        return false;
+
+    for (int byte = 0; byte < 256; byte++) {
+        char input = static_cast<char>(byte);
+        uint32_t output = 0;
+        char* inbuf = &input;
+        char* outbuf = reinterpret_cast<char*>(&output);
+        size_t inbytesleft = 1;
+        size_t outbytesleft = sizeof(output);
+
+        iconv(cd, nullptr, nullptr, nullptr, nullptr);
+
+        if (iconv(cd, &inbuf, &inbytesleft, &outbuf, &outbytesleft) == static_cast<size_t>(-1)) {
+            if (errno != EILSEQ)
+                return (iconv_close(cd), false);
+
+            continue;
+        }
+
+        if (outbytesleft != 0)
+            return (iconv_close(cd), false);
+
+        byte_to_unicode_[byte] = output;
     }
+
+    iconv_close(cd);
 #endif
-}
 
-bool Encoding_Converter::UTF8_To_Target(const std::string& utf8_str, char* out_buffer, size_t buffer_size, size_t& out_length) const {
-    if (!out_buffer || buffer_size == 0)
-        return false;
+    for (uint32_t byte = 0; byte < 0x80; byte++) {
+        if (byte_to_unicode_[byte] != byte)
+            return false;
+    }
 
-    std::string converted = UTF8_To_Target(utf8_str);
-    out_length = converted.length();
+    unicode_to_byte_.assign(0x10000, 0);
 
-    if (out_length >= buffer_size) {
-        Logger::Log(Log_Level::WARNING, "Encoding conversion result too large for buffer ('%zu' >= '%zu'). Truncating.", out_length, buffer_size);
+    for (int byte = 0xFF; byte >= 0x80; byte--) {
+        uint32_t code_point = byte_to_unicode_[byte];
 
-        out_length = buffer_size - 1;
+        if (code_point != UNMAPPED_CODE_POINT && code_point >= 0x80 && code_point < 0x10000)
+            unicode_to_byte_[code_point] = static_cast<uint8_t>(byte);
     }
 
-    memcpy(out_buffer, converted.c_str(), out_length);
-    out_buffer[out_length] = '\0';
-
     return true;
 }
 
-bool Encoding_Converter::Target_To_UTF8(const char* target_str, size_t target_len, std::string& out_utf8) const {
-    if (!target_str || target_len == 0)
-        return false;
+size_t Encoding_Converter::Max_Target_Length(size_t utf8_len) const {
+    if (!encoding_enabled_ || single_byte_)
+        return utf8_len;
+
+    return utf8_len * 4;
+}
 
-    std::string target(target_str, target_len);
-    out_utf8 = Target_To_UTF8(target);
+size_t Encoding_Converter::Max_UTF8_Length(size_t target_len) const {
+    if (!encoding_enabled_)
+        return target_len;
 
-    return true;
+    return target_len * (single_byte_ ? 3 : 4);
 }
 
-#if defined(_WIN32)
-std::wstring Encoding_Converter::UTF8_To_UTF16(const std::string& utf8_str) const {
-    if (utf8_str.empty())
-        return std::wstring();
+size_t Encoding_Converter::Single_Byte_From_UTF8(std::string_view utf8_str, char* out_buffer, size_t buffer_size) const {
+    const unsigned char* str = reinterpret_cast<const unsigned char*>(utf8_str.data());
+    size_t len = utf8_str.length();
+    size_t written = 0;
 
-    int required_size = MultiByteToWideChar(CP_UTF8, 0, utf8_str.c_str(), static_cast<int>(utf8_str.length()), nullptr, 0);
+    for (size_t i = 0; i < len && written < buffer_size;) {
+        if (str[i] < 0x80) {
+            size_t run = std::min(Simd::Find_Non_ASCII(utf8_str.data() + i, len - i), buffer_size - written);
 
-    if (required_size <= 0)
-        throw Encoding_Exception("'MultiByteToWideChar' failed (UTF8 to UTF16).");
+            memcpy(out_buffer + written, utf8_str.data() + i, run);
+            written += run;
+            i += run;
 
-    std::wstring utf16_str(required_size, 0);
+            continue;
+        }
 
-    int result = MultiByteToWideChar(CP_UTF8, 0, utf8_str.c_str(), static_cast<int>(utf8_str.length()), &utf16_str[0], required_size);
+        uint32_t code_point = 0;
+        size_t size = Decode_UTF8(str + i, len - i, code_point);
 
-    if (result <= 0)
-        throw Encoding_Exception("'MultiByteToWideChar' conversion failed.");
+        if (size == 0) {
+            out_buffer[written++] = REPLACEMENT_CHAR;
+            ++i;
 
-    return utf16_str;
+            continue;
+        }
+
+        uint8_t byte = code_point < 0x10000 ? unicode_to_byte_[code_point] : 0;
+
+        out_buffer[written++] = byte != 0 ? static_cast<char>(byte) : REPLACEMENT_CHAR;
+        i += size;
+    }
+
+    return written;
 }
 
-std::string Encoding_Converter::UTF16_To_UTF8(const std::wstring& utf16_str) const {
-    if (utf16_str.empty())
-        return std::string();
+size_t Encoding_Converter::Single_Byte_To_UTF8(std::string_view target_str, char* out_buffer, size_t buffer_size) const {
+    const unsigned char* str = reinterpret_cast<const unsigned char*>(target_str.data());
+    size_t len = target_str.length();
+    size_t written = 0;
 
-    int required_size = WideCharToMultiByte(CP_UTF8, 0, utf16_str.c_str(), static_cast<int>(utf16_str.length()), nullptr, 0, nullptr, nullptr);
+    for (size_t i = 0; i < len && written < buffer_size;) {
+        if (str[i] < 0x80) {
+            size_t run = std::min(Simd::Find_Non_ASCII(target_str.data() + i, len - i), buffer_size - written);
 
-    if (required_size <= 0)
-        throw Encoding_Exception("'WideCharToMultiByte' failed (UTF16 to UTF8).");
+            memcpy(out_buffer + written, target_str.data() + i, run);
+            written += run;
+            i += run;
 
-    std::string utf8_str(required_size, 0);
+            continue;
+        }
 
-    int result = WideCharToMultiByte(CP_UTF8, 0, utf16_str.c_str(), static_cast<int>(utf16_str.length()), &utf8_str[0], required_size, nullptr, nullptr);
+        uint32_t code_point = byte_to_unicode_[str[i++]];
 
-    if (result <= 0)
-        throw Encoding_Exception("'WideCharToMultiByte' conversion failed.");
+        if (code_point == UNMAPPED_CODE_POINT)
+            out_buffer[written++] = REPLACEMENT_CHAR;
+        else {
+            size_t size = Encode_UTF8(code_point, out_buffer + written, buffer_size - written);
+
+            if (size == 0)
+                break;
+
+            written += size;
+        }
+    }
 
-    return utf8_str;
+    return written;
 }
 
-std::string Encoding_Converter::UTF16_To_CodePage(const std::wstring& utf16_str, unsigned int codepage) const {
-    if (utf16_str.empty())
-        return std::string();
+std::string Encoding_Converter::UTF8_To_Target(const std::string& utf8_str) const {
+    std::string result(Max_Target_Length(utf8_str.length()), '\0');
+    result.resize(UTF8_To_Target(utf8_str, result.data(), result.size()));
 
-    int required_size = WideCharToMultiByte(codepage, 0, utf16_str.c_str(), static_cast<int>(utf16_str.length()), nullptr, 0, nullptr, nullptr);
+    return result;
+}
 
-    if (required_size <= 0)
-        throw Encoding_Exception("'WideCharToMultiByte' failed (UTF16 to CodePage).");
+std::string Encoding_Converter::Target_To_UTF8(const std::string& target_str) const {
+    std::string result(Max_UTF8_Length(target_str.length()), '\0');
+    result.resize(Target_To_UTF8(target_str, result.data(), result.size()));
 
-    std::string target_str(required_size, 0);
+    return result;
+}
 
-    int result = WideCharToMultiByte(codepage, 0, utf16_str.c_str(), static_cast<int>(utf16_str.length()), &target_str[0], required_size, nullptr, nullptr);
+size_t Encoding_Converter::UTF8_To_Target(std::string_view utf8_str, char* out_buffer, size_t buffer_size) const {
+    if (!encoding_enabled_ || utf8_str.empty())
+        return Copy_Bytes(utf8_str, out_buffer, buffer_size);
 
-    if (result <= 0)
-        throw Encoding_Exception("'WideCharToMultiByte' conversion to target codepage failed.");
+    if (ascii_compatible_ && Simd::Is_ASCII(utf8_str.data(), utf8_str.length()))
+        return Copy_Bytes(utf8_str, out_buffer, buffer_size);
+
+    if (single_byte_)
+        return Single_Byte_From_UTF8(utf8_str, out_buffer, buffer_size);
+
+#if defined(_WIN32)
+    if (target_codepage_ == 65001)
+        return Copy_Bytes(utf8_str, out_buffer, buffer_size);
+
+    try {
+        size_t utf16_len = To_UTF16(utf8_str, CP_UTF8);
+
+        return From_UTF16(utf16_len, target_codepage_, out_buffer, buffer_size);
+    }
+    catch (const Encoding_Exception& e) {
+        return (Logger::Log(Log_Level::ERROR_s, "UTF8_To_Target conversion failed: '%s'. Returning original string.", e.what()), Copy_Bytes(utf8_str, out_buffer, buffer_size));
+    }
+#elif defined(__linux__)
+    if (target_encoding_ == "UTF-8")
+        return Copy_Bytes(utf8_str, out_buffer, buffer_size);
 
-    return target_str;
+    try {
+        return Iconv_Convert(utf8_str, UTF8_ENCODING, target_encoding_, out_buffer, buffer_size);
+    }
+    catch (const Encoding_Exception& e) {
+        return (Logger::Log(Log_Level::ERROR_s, "UTF8_To_Target conversion failed: '%s'. Returning original string.", e.what()), Copy_Bytes(utf8_str, out_buffer, buffer_size));
+    }
+#endif
 }
 
-std::wstring Encoding_Converter::CodePage_To_UTF16(const std::string& str, unsigned int codepage) const {
-    if (str.empty())
-        return std::wstring();
+size_t Encoding_Converter::Target_To_UTF8(std::string_view target_str, char* out_buffer, size_t buffer_size) const {
+    if (!encoding_enabled_ || target_str.empty())
+        return Copy_Bytes(target_str, out_buffer, buffer_size);
+
+    if (ascii_compatible_ && Simd::Is_ASCII(target_str.data(), target_str.length()))
+        return Copy_Bytes(target_str, out_buffer, buffer_size);
+
+    if (single_byte_)
+        return Single_Byte_To_UTF8(target_str, out_buffer, buffer_size);
+
+#if defined(_WIN32)
+    if (target_codepage_ == 65001)
+        return Copy_Bytes(target_str, out_buffer, buffer_size);
+
+    try {
+        size_t utf16_len = To_UTF16(target_str, target_codepage_);
+
+        return From_UTF16(utf16_len, CP_UTF8, out_buffer, buffer_size);
+    }
+    catch (const Encoding_Exception& e) {
+        return (Logger::Log(Log_Level::ERROR_s, "Target_To_UTF8 conversion failed: '%s'. Returning original string.", e.what()), Copy_Bytes(target_str, out_buffer, buffer_size));
+    }
+#elif defined(__linux__)
+    if (target_encoding_ == "UTF-8")
+        return Copy_Bytes(target_str, out_buffer, buffer_size);
+
+    try {
+        return Iconv_Convert(target_str, target_encoding_, UTF8_ENCODING, out_buffer, buffer_size);
+    }
+    catch (const Encoding_Exception& e) {
+        return (Logger::Log(Log_Level::ERROR_s, "Target_To_UTF8 conversion failed: '%s'. Returning original string.", e.what()), Copy_Bytes(target_str, out_buffer, buffer_size));
+    }
+#endif
+}
 
-    int required_size = MultiByteToWideChar(codepage, 0, str.c_str(), static_cast<int>(str.length()), nullptr, 0);
+#if defined(_WIN32)
+size_t Encoding_Converter::To_UTF16(std::string_view str, unsigned int codepage) const {
+    int required_size = MultiByteToWideChar(codepage, 0, str.data(), static_cast<int>(str.length()), nullptr, 0);
 
     if (required_size <= 0)
-        throw Encoding_Exception("'MultiByteToWideChar' failed (CodePage to UTF16).");
+        throw Encoding_Exception("'MultiByteToWideChar' failed (to UTF16).");
 
-    std::wstring utf16_str(required_size, 0);
+    if (tl_utf16_buffer.size() < static_cast<size_t>(required_size))
+        tl_utf16_buffer.resize(required_size);
 
-    int result = MultiByteToWideChar(codepage, 0, str.c_str(), static_cast<int>(str.length()), &utf16_str[0], required_size);
+    int result = MultiByteToWideChar(codepage, 0, str.data(), static_cast<int>(str.length()), tl_utf16_buffer.data(), required_size);
 
     if (result <= 0)
-        throw Encoding_Exception("'MultiByteToWideChar' conversion from codepage failed.");
+        throw Encoding_Exception("'MultiByteToWideChar' conversion failed.");
 
-    return utf16_str;
+    return static_cast<size_t>(result);
 }
-#elif defined(__linux__)
-std::string Encoding_Converter::Iconv_Convert(const std::string& input, const std::string& from_encoding, const std::string& to_encoding) const {
-    if (input.empty())
-        return std::string();
 
-    iconv_t cd = iconv_open(to_encoding.c_str(), from_encoding.c_str());
+size_t Encoding_Converter::From_UTF16(size_t utf16_len, unsigned int codepage, char* out_buffer, size_t buffer_size) const {
+    int result = WideCharToMultiByte(codepage, 0, tl_utf16_buffer.data(), static_cast<int>(utf16_len), out_buffer, static_cast<int>(buffer_size), nullptr, nullptr);
+
+    if (result <= 0)
+        throw Encoding_Exception("'WideCharToMultiByte' conversion failed (from UTF16).");
+
+    return static_cast<size_t>(result);
+}
+#elif defined(__linux__)
+size_t Encoding_Converter::Iconv_Convert(std::string_view input, const std::string& from_encoding, const std::string& to_encoding, char* out_buffer, size_t buffer_size) const {
+    iconv_t cd = Acquire_Iconv(from_encoding, to_encoding);
     
-    if (cd == (iconv_t)-1)
+    if (cd == reinterpret_cast<iconv_t>(-1))
         throw Encoding_Exception("'iconv_open' failed: " + std::string(strerror(errno)));
 
-    size_t inbytesleft = input.size();
-    size_t outbufsize = inbytesleft * 4 + 1;
-    std::vector<char> outbuf(outbufsize);
-    
     char* inbuf = const_cast<char*>(input.data());
-    char* outptr = outbuf.data();
-    size_t outbytesleft = outbufsize;
-
-    size_t result = iconv(cd, &inbuf, &inbytesleft, &outptr, &outbytesleft);
-    
-    iconv_close(cd);
+    size_t inbytesleft = input.size();
+    char* outptr = out_buffer;
+    size_t outbytesleft = buffer_size;
 
-    if (result == (size_t)-1) {
-        if (errno == E2BIG)
-            throw Encoding_Exception("'iconv' output buffer too small.");
-        else if (errno == EILSEQ)
+    if (iconv(cd, &inbuf, &inbytesleft, &outptr, &outbytesleft) == static_cast<size_t>(-1)) {
+        if (errno == EILSEQ)
             throw Encoding_Exception("'iconv' invalid multibyte sequence.");
         else if (errno == EINVAL)
             throw Encoding_Exception("'iconv' incomplete multibyte sequence.");
-        else
+        else if (errno != E2BIG)
             throw Encoding_Exception("'iconv' conversion failed: " + std::string(strerror(errno)));
     }
 
-    size_t converted_size = outbufsize - outbytesleft;
-
-    return std::string(outbuf.data(), converted_size);
+    return buffer_size - outbytesleft;
 }
 #endif
\ No newline at end of file
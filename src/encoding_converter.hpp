@@ -33,6 +33,10 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <array>
+#include <vector>
+#include <cstdint>
 
 class Encoding_Converter {
     public:
@@ -55,8 +59,11 @@ class Encoding_Converter {
         std::string UTF8_To_Target(const std::string& utf8_str) const;
         std::string Target_To_UTF8(const std::string& target_str) const;
 
-        bool UTF8_To_Target(const std::string& utf8_str, char* out_buffer, size_t buffer_size, size_t& out_length) const;
-        bool Target_To_UTF8(const char* target_str, size_t target_len, std::string& out_utf8) const;
+        size_t Max_Target_Length(size_t utf8_len) const;
+        size_t Max_UTF8_Length(size_t target_len) const;
+
+        size_t UTF8_To_Target(std::string_view utf8_str, char* out_buffer, size_t buffer_size) const;
+        size_t Target_To_UTF8(std::string_view target_str, char* out_buffer, size_t buffer_size) const;
 
     private:
         Encoding_Converter() = default;
@@ -70,12 +77,20 @@ class Encoding_Converter {
         std::string target_encoding_;
         bool is_windows_mode_ = true;
 
+        bool single_byte_ = false;
+        bool ascii_compatible_ = false;
+        std::array<uint32_t, 256> byte_to_unicode_ {};
+        std::vector<uint8_t> unicode_to_byte_;
+
+        bool Build_Single_Byte_Tables();
+        bool Probe_ASCII_Compatible() const;
+        size_t Single_Byte_From_UTF8(std::string_view utf8_str, char* out_buffer, size_t buffer_size) const;
+        size_t Single_Byte_To_UTF8(std::string_view target_str, char* out_buffer, size_t buffer_size) const;
+
 #if defined(_WIN32)
-        std::wstring UTF8_To_UTF16(const std::string& utf8_str) const;
-        std::string UTF16_To_UTF8(const std::wstring& utf16_str) const;
-        std::string UTF16_To_CodePage(const std::wstring& utf16_str, unsigned int codepage) const;
-        std::wstring CodePage_To_UTF16(const std::string& str, unsigned int codepage) const;
+        size_t To_UTF16(std::string_view str, unsigned int codepage) const;
+        size_t From_UTF16(size_t utf16_len, unsigned int codepage, char* out_buffer, size_t buffer_size) const;
 #elif defined(__linux__)
-        std::string Iconv_Convert(const std::string& input, const std::string& from_encoding, const std::string& to_encoding) const;
+        size_t Iconv_Convert(std::string_view input, const std::string& from_encoding, const std::string& to_encoding, char* out_buffer, size_t buffer_size) const;
 #endif
 };
\ No newline at end of file
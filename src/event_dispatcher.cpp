@@ -30,6 +30,8 @@
  *                                                                              *
  * ============================================================================ */
 
+#include <vector>
+//
 #include "sdk/amx/amx_defs.h"
 #include "sdk/hooks/interceptor_manager.hpp"
 //
@@ -40,6 +42,7 @@
 #include "natives.hpp"
 #include "native_hooks.hpp"
 #include "publics.hpp"
+#include "public_registry.hpp"
 #include "constants.hpp"
 #include "logger.hpp"
 
@@ -49,46 +52,20 @@ Event_Dispatcher& Event_Dispatcher::Instance() {
     return instance;
 }
 
-bool Event_Dispatcher::Has_Listeners(const std::string& event_name) {
-    auto& runtime = Runtime_Manager::Instance();
-
-    if (!runtime.Is_Runtime_Ready())
-        return (Logger::Log(Log_Level::WARNING, "'Has_Listeners' called but runtime not ready."), false);
-
-    v8::Isolate* isolate = runtime.Get_Isolate();
-    
-    v8::Locker locker(isolate);
-    v8::Isolate::Scope isolate_scope(isolate);
-    v8::HandleScope handle_scope(isolate);
-    
-    v8::Local<v8::Context> context = runtime.Get_Context();
-
-    if (context.IsEmpty())
-        return false;
-    
-    v8::Context::Scope context_scope(context);
-
-    v8::Local<v8::Function> has_listeners_func = Get_Has_Listeners_Function(isolate, context);
-
-    if (has_listeners_func.IsEmpty())
-        return false;
-
-    v8::Local<v8::Object> global = context->Global();
-    v8::Local<v8::Value> event_name_val = v8::String::NewFromUtf8(isolate, event_name.c_str()).ToLocalChecked();
-    v8::MaybeLocal<v8::Value> result_maybe = has_listeners_func->Call(context, global, 1, &event_name_val);
-    v8::Local<v8::Value> result_val;
-
-    if (result_maybe.ToLocal(&result_val) && result_val->IsBoolean())
-        return result_val->BooleanValue(isolate);
-
-    return false;
+bool Event_Dispatcher::Has_Listeners(const std::string& event_name) const {
+    return Public_Registry::Instance().Has_Listeners(event_name);
 }
 
-std::string Event_Dispatcher::Get_Signature(const std::string& event_name) {
+cell Event_Dispatcher::Dispatch_Event(const std::string& event_name) {
     auto& runtime = Runtime_Manager::Instance();
 
     if (!runtime.Is_Runtime_Ready())
-        return "";
+        return PUBLIC_CONTINUE;
+
+    Public_Entry* entry = Public_Registry::Instance().Find(event_name);
+
+    if (!entry || entry->listener_count == 0)
+        return PUBLIC_CONTINUE;
 
     v8::Isolate* isolate = runtime.Get_Isolate();
     
@@ -99,66 +76,53 @@ std::string Event_Dispatcher::Get_Signature(const std::string& event_name) {
     v8::Local<v8::Context> context = runtime.Get_Context();
 
     if (context.IsEmpty())
-        return "";
+        return PUBLIC_CONTINUE;
     
     v8::Context::Scope context_scope(context);
 
-    v8::Local<v8::Function> sig_func = Get_Signature_Function(isolate, context);
-    
-    if (sig_func.IsEmpty())
-        return "";
-
-    v8::Local<v8::Object> global = context->Global();
-    v8::Local<v8::Value> arg = v8::String::NewFromUtf8(isolate, event_name.c_str()).ToLocalChecked();
+    return Dispatch_Event(isolate, context, *entry, nullptr, 0);
+}
 
+cell Event_Dispatcher::Dispatch_Event(v8::Isolate* isolate, v8::Local<v8::Context> context, Public_Entry& entry, v8::Local<v8::Value>* args, size_t argc) {
     v8::TryCatch try_catch(isolate);
-    v8::MaybeLocal<v8::Value> result = sig_func->Call(context, global, 1, &arg);
-
-    if (try_catch.HasCaught() || result.IsEmpty())
-        return "";
 
-    v8::Local<v8::Value> val = result.ToLocalChecked();
-    
-    if (!val->IsString())
-        return "";
+    if (entry.listeners_dirty && !Refresh_Listeners(isolate, context, entry)) {
+        if (try_catch.HasCaught())
+            Error_Handler::Log_Exception(isolate, try_catch);
 
-    v8::String::Utf8Value utf8(isolate, val);
-    
-    return std::string(*utf8);
-}
+        return PUBLIC_CONTINUE;
+    }
 
-cell Event_Dispatcher::Dispatch_Event(const std::string& event_name, AMX* amx, const std::vector<v8::Local<v8::Value>>& args) {
-    auto& runtime = Runtime_Manager::Instance();
+    size_t listener_count = entry.listeners.size();
 
-    if (!runtime.Is_Runtime_Ready())
+    if (listener_count == 0)
         return PUBLIC_CONTINUE;
 
-    v8::Isolate* isolate = runtime.Get_Isolate();
-    
-    v8::Locker locker(isolate);
-    v8::Isolate::Scope isolate_scope(isolate);
-    v8::HandleScope handle_scope(isolate);
-    
-    v8::Local<v8::Context> context = runtime.Get_Context();
+    v8::Local<v8::Value> receiver = v8::Undefined(isolate);
+    v8::MaybeLocal<v8::Value> result_maybe;
 
-    if (context.IsEmpty())
-        return PUBLIC_CONTINUE;
-    
-    v8::Context::Scope context_scope(context);
-    v8::TryCatch try_catch(isolate);
+    if (listener_count == 1)
+        result_maybe = entry.listeners[0].Get(isolate)->Call(context, receiver, static_cast<int>(argc), args);
+    else {
+        v8::Local<v8::Function> listeners_stack[Constants::STACK_ARGS_THRESHOLD];
+        std::vector<v8::Local<v8::Function>> listeners_heap;
+        v8::Local<v8::Function>* listeners = listeners_stack;
 
-    v8::Local<v8::Function> emit_func = Get_Emit_Function(isolate, context);
+        if (listener_count > Constants::STACK_ARGS_THRESHOLD) {
+            listeners_heap.resize(listener_count);
+            listeners = listeners_heap.data();
+        }
 
-    if (emit_func.IsEmpty())
-        return PUBLIC_CONTINUE;
+        for (size_t i = 0; i < listener_count; i++)
+            listeners[i] = entry.listeners[i].Get(isolate);
 
-    std::vector<v8::Local<v8::Value>> call_args;
-    call_args.reserve(args.size() + 1);
-    call_args.push_back(v8::String::NewFromUtf8(isolate, event_name.c_str(), v8::NewStringType::kNormal).ToLocalChecked());
-    call_args.insert(call_args.end(), args.begin(), args.end());
+        for (size_t i = 0; i < listener_count; i++) {
+            result_maybe = listeners[i]->Call(context, receiver, static_cast<int>(argc), args);
 
-    v8::Local<v8::Object> global = context->Global();
-    v8::MaybeLocal<v8::Value> result_maybe = emit_func->Call(context, global, call_args.size(), call_args.data());
+            if (try_catch.HasCaught())
+                break;
+        }
+    }
 
     if (try_catch.HasCaught())
         return (Error_Handler::Log_Exception(isolate, try_catch), PUBLIC_CONTINUE);
@@ -171,6 +135,36 @@ cell Event_Dispatcher::Dispatch_Event(const std::string& event_name, AMX* amx, c
     return Type_Converter::To_Return_Code(isolate, context, result_val);
 }
 
+bool Event_Dispatcher::Refresh_Listeners(v8::Isolate* isolate, v8::Local<v8::Context> context, Public_Entry& entry) {
+    v8::Local<v8::Function> listeners_func = Get_Listeners_Function(isolate, context);
+
+    if (listeners_func.IsEmpty())
+        return false;
+
+    v8::Local<v8::Value> name_val = entry.Get_V8_Name(isolate);
+    v8::Local<v8::Value> result_val;
+
+    if (!listeners_func->Call(context, context->Global(), 1, &name_val).ToLocal(&result_val) || !result_val->IsArray())
+        return false;
+
+    v8::Local<v8::Array> listeners_arr = result_val.As<v8::Array>();
+    uint32_t length = listeners_arr->Length();
+
+    entry.listeners.clear();
+    entry.listeners.reserve(length);
+
+    for (uint32_t i = 0; i < length; i++) {
+        v8::Local<v8::Value> listener_val;
+
+        if (listeners_arr->Get(context, i).ToLocal(&listener_val) && listener_val->IsFunction())
+            entry.listeners.emplace_back(isolate, listener_val.As<v8::Function>());
+    }
+
+    entry.listeners_dirty = false;
+
+    return true;
+}
+
 void Event_Dispatcher::Generate_Native_Bindings() {
     auto& runtime = Runtime_Manager::Instance();
 
@@ -210,6 +204,8 @@ void Event_Dispatcher::Generate_Native_Bindings() {
     for (const auto& pair : all_natives)
         Natives::Generate_Binding(isolate, native_obj, pair.second, pair.first);
 
+    Natives::Generate_Batch_Bindings(isolate, context);
+
     if (try_catch.HasCaught())
         Error_Handler::Log_Exception(isolate, try_catch);
 }
@@ -256,6 +252,49 @@ void Event_Dispatcher::Generate_Hook_Bindings() {
         Error_Handler::Log_Exception(isolate, try_catch);
 }
 
+void Event_Dispatcher::Generate_Registry_Bindings() {
+    auto& runtime = Runtime_Manager::Instance();
+
+    if (!runtime.Is_Runtime_Ready())
+        return (void)Logger::Log(Log_Level::WARNING, "Cannot generate registry bindings: runtime not ready.");
+
+    v8::Isolate* isolate = runtime.Get_Isolate();
+    
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    
+    v8::Local<v8::Context> context = runtime.Get_Context();
+
+    if (context.IsEmpty())
+        return;
+    
+    v8::Context::Scope context_scope(context);
+    v8::TryCatch try_catch(isolate);
+
+    auto Register_Public_JS = [](const v8::FunctionCallbackInfo<v8::Value>& info) {
+        v8::Isolate* isolate = info.GetIsolate();
+
+        if (info.Length() < 3 || !info[0]->IsString() || !info[1]->IsString() || !info[2]->IsUint32())
+            return;
+
+        v8::String::Utf8Value name_utf8(isolate, info[0]);
+        v8::String::Utf8Value signature_utf8(isolate, info[1]);
+        uint32_t listener_count = info[2].As<v8::Uint32>()->Value();
+
+        Public_Entry& entry = Public_Registry::Instance().Register(*name_utf8, *signature_utf8, listener_count);
+        entry.Get_V8_Name(isolate);
+    };
+
+    v8::Local<v8::Function> fn;
+
+    if (v8::Function::New(context, Register_Public_JS).ToLocal(&fn))
+        context->Global()->Set(context, v8::String::NewFromUtf8(isolate, Constants::JS_REGISTER_PUBLIC).ToLocalChecked(), fn).Check();
+
+    if (try_catch.HasCaught())
+        Error_Handler::Log_Exception(isolate, try_catch);
+}
+
 void Event_Dispatcher::Generate_Public_Bindings() {
     auto& runtime = Runtime_Manager::Instance();
 
@@ -294,6 +333,15 @@ void Event_Dispatcher::Generate_Public_Bindings() {
         kainure_obj->Set(context, fn_name, fn).Check();
     }
 
+    v8::Local<v8::FunctionTemplate> bind_tpl = v8::FunctionTemplate::New(isolate, Publics::Bind_Handler);
+
+    if (bind_tpl->GetFunction(context).ToLocal(&fn)) {
+        v8::Local<v8::String> fn_name = v8::String::NewFromUtf8(isolate, Constants::JS_BIND_PUBLIC_OBJECT, v8::NewStringType::kInternalized).ToLocalChecked();
+        fn->SetName(fn_name);
+
+        kainure_obj->Set(context, fn_name, fn).Check();
+    }
+
     if (try_catch.HasCaught())
         Error_Handler::Log_Exception(isolate, try_catch);
 }
@@ -317,14 +365,6 @@ v8::Local<v8::Function> Event_Dispatcher::Get_Cached_Function(v8::Isolate* isola
     return cached_func.Get(isolate);
 }
 
-v8::Local<v8::Function> Event_Dispatcher::Get_Emit_Function(v8::Isolate* isolate, v8::Local<v8::Context> context) {
-    return Get_Cached_Function(isolate, context, cached_emit_func_, emit_func_cached_, Constants::JS_EMIT_EVENT);
-}
-
-v8::Local<v8::Function> Event_Dispatcher::Get_Has_Listeners_Function(v8::Isolate* isolate, v8::Local<v8::Context> context) {
-    return Get_Cached_Function(isolate, context, cached_has_listeners_func_, has_listeners_func_cached_, Constants::JS_HAS_LISTENERS);
-}
-
-v8::Local<v8::Function> Event_Dispatcher::Get_Signature_Function(v8::Isolate* isolate, v8::Local<v8::Context> context) {
-    return Get_Cached_Function(isolate, context, cached_signature_func_, signature_func_cached_, Constants::JS_GET_SIGNATURE);
+v8::Local<v8::Function> Event_Dispatcher::Get_Listeners_Function(v8::Isolate* isolate, v8::Local<v8::Context> context) {
+    return Get_Cached_Function(isolate, context, cached_listeners_func_, listeners_func_cached_, Constants::JS_GET_LISTENERS);
 }
\ No newline at end of file
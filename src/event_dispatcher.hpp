@@ -33,27 +33,26 @@
 #pragma once
 
 #include <string>
-#include <vector>
+#include <cstddef>
 //
 #include "sdk/amx/amx_defs.h"
 //
 #include "node_inclusion.hpp"
+//
+#include "public_registry.hpp"
 
 class Event_Dispatcher {
     public:
         static Event_Dispatcher& Instance();
 
-        bool Has_Listeners(const std::string& event_name);
-        std::string Get_Signature(const std::string& event_name);
-
-        cell Dispatch_Event(const std::string& event_name, AMX* amx, const std::vector<v8::Local<v8::Value>>& args);
+        bool Has_Listeners(const std::string& event_name) const;
 
-        cell Dispatch_Event(const std::string& event_name) {
-            return Dispatch_Event(event_name, nullptr, {});
-        }
+        cell Dispatch_Event(const std::string& event_name);
+        cell Dispatch_Event(v8::Isolate* isolate, v8::Local<v8::Context> context, Public_Entry& entry, v8::Local<v8::Value>* args, size_t argc);
 
         void Generate_Native_Bindings();
         void Generate_Hook_Bindings();
+        void Generate_Registry_Bindings();
         void Generate_Public_Bindings();
 
     private:
@@ -64,15 +63,10 @@ class Event_Dispatcher {
         Event_Dispatcher& operator=(const Event_Dispatcher&) = delete;
 
         v8::Local<v8::Function> Get_Cached_Function(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Persistent<v8::Function>& cached_func, bool& is_cached, const char* global_name);
-        v8::Local<v8::Function> Get_Emit_Function(v8::Isolate* isolate, v8::Local<v8::Context> context);
-        v8::Local<v8::Function> Get_Has_Listeners_Function(v8::Isolate* isolate, v8::Local<v8::Context> context);
-        v8::Local<v8::Function> Get_Signature_Function(v8::Isolate* isolate, v8::Local<v8::Context> context);
+        v8::Local<v8::Function> Get_Listeners_Function(v8::Isolate* isolate, v8::Local<v8::Context> context);
+        bool Refresh_Listeners(v8::Isolate* isolate, v8::Local<v8::Context> context, Public_Entry& entry);
 
-        v8::Persistent<v8::Function> cached_emit_func_;
-        v8::Persistent<v8::Function> cached_has_listeners_func_;
-        v8::Persistent<v8::Function> cached_signature_func_;
+        v8::Persistent<v8::Function> cached_listeners_func_;
 
-        bool emit_func_cached_ = false;
-        bool has_listeners_func_cached_ = false;
-        bool signature_func_cached_ = false;
+        bool listeners_func_cached_ = false;
 };
\ No newline at end of file
@@ -32,6 +32,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <algorithm>
 //
 #include "nlohmann/json.hpp"
 //
@@ -173,8 +174,26 @@ void File_Manager::Create_Default_Config() {
         nlohmann::ordered_json typescript;
         typescript[Constants::CONFIG_KEY_TS_ENABLED] = false;
         typescript[Constants::CONFIG_KEY_TS_OUT_DIR] = Constants::DEFAULT_TS_OUT_DIR;
+        typescript[Constants::CONFIG_KEY_TS_MODE] = Constants::TS_MODE_CHECK;
+        typescript[Constants::CONFIG_KEY_TS_BACKGROUND_CHECK] = false;
         j[Constants::CONFIG_KEY_TYPESCRIPT] = typescript;
 
+        nlohmann::ordered_json runtime;
+        runtime[Constants::CONFIG_KEY_PLATFORM_THREADS] = Constants::V8_PLATFORM_THREADS;
+        runtime[Constants::CONFIG_KEY_CPU_AFFINITY] = nlohmann::ordered_json::array();
+        runtime[Constants::CONFIG_KEY_TICK_BUDGET] = Constants::DEFAULT_TICK_BUDGET_MS;
+        runtime[Constants::CONFIG_KEY_STARTUP_SNAPSHOT] = false;
+        runtime[Constants::CONFIG_KEY_CODE_CACHE] = true;
+        j[Constants::CONFIG_KEY_RUNTIME] = runtime;
+
+        nlohmann::ordered_json v8;
+        v8[Constants::CONFIG_KEY_V8_MAX_OLD_SPACE] = 0;
+        v8[Constants::CONFIG_KEY_V8_INITIAL_OLD_SPACE] = 0;
+        v8[Constants::CONFIG_KEY_V8_MAX_SEMI_SPACE] = 0;
+        v8[Constants::CONFIG_KEY_V8_EXPOSE_GC] = false;
+        v8[Constants::CONFIG_KEY_V8_FLAGS] = nlohmann::ordered_json::array();
+        j[Constants::CONFIG_KEY_V8] = v8;
+
         std::ofstream file(Constants::FILE_CONFIG);
 
         if (!file.is_open())
@@ -196,6 +215,20 @@ void File_Manager::Create_Default_Config() {
 
         config_.use_typescript = false;
         config_.ts_output_dir = Constants::DEFAULT_TS_OUT_DIR;
+        config_.ts_mode = Constants::TS_MODE_CHECK;
+        config_.ts_background_check = false;
+
+        config_.platform_threads = Constants::V8_PLATFORM_THREADS;
+        config_.cpu_affinity.clear();
+        config_.tick_budget_ms = Constants::DEFAULT_TICK_BUDGET_MS;
+        config_.use_startup_snapshot = false;
+        config_.use_code_cache = true;
+
+        config_.v8_max_old_space_mb = 0;
+        config_.v8_initial_old_space_mb = 0;
+        config_.v8_max_semi_space_mb = 0;
+        config_.v8_expose_gc = false;
+        config_.v8_flags.clear();
     }
     catch (const nlohmann::json::exception& e) {
         Logger::Log(Log_Level::ERROR_s, "JSON error while creating default config: '%s'.", e.what());
@@ -222,6 +255,20 @@ void File_Manager::Set_Default_Config() {
 
     config_.use_typescript = false;
     config_.ts_output_dir = Constants::DEFAULT_TS_OUT_DIR;
+    config_.ts_mode = Constants::TS_MODE_CHECK;
+    config_.ts_background_check = false;
+
+    config_.platform_threads = Constants::V8_PLATFORM_THREADS;
+    config_.cpu_affinity.clear();
+    config_.tick_budget_ms = Constants::DEFAULT_TICK_BUDGET_MS;
+    config_.use_startup_snapshot = false;
+    config_.use_code_cache = true;
+
+    config_.v8_max_old_space_mb = 0;
+    config_.v8_initial_old_space_mb = 0;
+    config_.v8_max_semi_space_mb = 0;
+    config_.v8_expose_gc = false;
+    config_.v8_flags.clear();
 }
 
 bool File_Manager::Validate_Main_File(const std::string& path) const {
@@ -457,6 +504,52 @@ bool File_Manager::Load_Config() {
         
         Load_JSON_Field(typescript, Constants::CONFIG_KEY_TS_ENABLED, config_.use_typescript, false, typescript, save_needed);
         Load_JSON_Field(typescript, Constants::CONFIG_KEY_TS_OUT_DIR, config_.ts_output_dir, std::string(Constants::DEFAULT_TS_OUT_DIR), typescript, save_needed);
+        Load_JSON_Field(typescript, Constants::CONFIG_KEY_TS_MODE, config_.ts_mode, std::string(Constants::TS_MODE_CHECK), typescript, save_needed);
+        Load_JSON_Field(typescript, Constants::CONFIG_KEY_TS_BACKGROUND_CHECK, config_.ts_background_check, false, typescript, save_needed);
+
+        if (config_.ts_mode != Constants::TS_MODE_CHECK && config_.ts_mode != Constants::TS_MODE_TRANSPILE && config_.ts_mode != Constants::TS_MODE_ON_DEMAND) {
+            Logger::Log(Log_Level::WARNING, "Unknown '%s' value '%s'. Expected '%s', '%s' or '%s'. Using '%s'.", Constants::CONFIG_KEY_TS_MODE, config_.ts_mode.c_str(), Constants::TS_MODE_CHECK, Constants::TS_MODE_TRANSPILE, Constants::TS_MODE_ON_DEMAND, Constants::TS_MODE_CHECK);
+
+            config_.ts_mode = Constants::TS_MODE_CHECK;
+        }
+
+        Ensure_JSON_Section(j, Constants::CONFIG_KEY_RUNTIME, save_needed);
+        nlohmann::ordered_json& runtime = j[Constants::CONFIG_KEY_RUNTIME];
+
+        Load_JSON_Field(runtime, Constants::CONFIG_KEY_PLATFORM_THREADS, config_.platform_threads, Constants::V8_PLATFORM_THREADS, runtime, save_needed);
+        Load_JSON_Field(runtime, Constants::CONFIG_KEY_CPU_AFFINITY, config_.cpu_affinity, std::vector<int>(), runtime, save_needed);
+        Load_JSON_Field(runtime, Constants::CONFIG_KEY_TICK_BUDGET, config_.tick_budget_ms, Constants::DEFAULT_TICK_BUDGET_MS, runtime, save_needed);
+        Load_JSON_Field(runtime, Constants::CONFIG_KEY_STARTUP_SNAPSHOT, config_.use_startup_snapshot, false, runtime, save_needed);
+        Load_JSON_Field(runtime, Constants::CONFIG_KEY_CODE_CACHE, config_.use_code_cache, true, runtime, save_needed);
+
+        if (config_.tick_budget_ms < 0.0) {
+            Logger::Log(Log_Level::WARNING, "'%s' cannot be negative. Disabling the tick budget.", Constants::CONFIG_KEY_TICK_BUDGET);
+
+            config_.tick_budget_ms = 0.0;
+        }
+
+        if (config_.platform_threads < 1 || config_.platform_threads > Constants::V8_MAX_PLATFORM_THREADS) {
+            Logger::Log(Log_Level::WARNING, "'%s' must be between 1 and %d (got '%d'). Clamping.", Constants::CONFIG_KEY_PLATFORM_THREADS, Constants::V8_MAX_PLATFORM_THREADS, config_.platform_threads);
+
+            config_.platform_threads = std::clamp(config_.platform_threads, 1, Constants::V8_MAX_PLATFORM_THREADS);
+        }
+
+        Ensure_JSON_Section(j, Constants::CONFIG_KEY_V8, save_needed);
+        nlohmann::ordered_json& v8 = j[Constants::CONFIG_KEY_V8];
+
+        Load_JSON_Field(v8, Constants::CONFIG_KEY_V8_MAX_OLD_SPACE, config_.v8_max_old_space_mb, 0, v8, save_needed);
+        Load_JSON_Field(v8, Constants::CONFIG_KEY_V8_INITIAL_OLD_SPACE, config_.v8_initial_old_space_mb, 0, v8, save_needed);
+        Load_JSON_Field(v8, Constants::CONFIG_KEY_V8_MAX_SEMI_SPACE, config_.v8_max_semi_space_mb, 0, v8, save_needed);
+        Load_JSON_Field(v8, Constants::CONFIG_KEY_V8_EXPOSE_GC, config_.v8_expose_gc, false, v8, save_needed);
+        Load_JSON_Field(v8, Constants::CONFIG_KEY_V8_FLAGS, config_.v8_flags, std::vector<std::string>(), v8, save_needed);
+
+        for (int* size : { &config_.v8_max_old_space_mb, &config_.v8_initial_old_space_mb, &config_.v8_max_semi_space_mb }) {
+            if (*size < 0) {
+                Logger::Log(Log_Level::WARNING, "Negative heap size '%d' in '%s' section. Using V8 default.", *size, Constants::CONFIG_KEY_V8);
+
+                *size = 0;
+            }
+        }
 
         if (save_needed)
             Save_JSON_Config(j, Constants::FILE_CONFIG);
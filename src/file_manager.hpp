@@ -33,6 +33,9 @@
 #pragma once
 
 #include <string>
+#include <vector>
+//
+#include "constants.hpp"
 
 class File_Manager {
     public:
@@ -44,6 +47,20 @@ class File_Manager {
 
             bool use_typescript = false;
             std::string ts_output_dir;
+            std::string ts_mode = Constants::TS_MODE_CHECK;
+            bool ts_background_check = false;
+
+            int platform_threads = Constants::V8_PLATFORM_THREADS;
+            std::vector<int> cpu_affinity;
+            double tick_budget_ms = Constants::DEFAULT_TICK_BUDGET_MS;
+            bool use_startup_snapshot = false;
+            bool use_code_cache = true;
+
+            int v8_max_old_space_mb = 0;
+            int v8_initial_old_space_mb = 0;
+            int v8_max_semi_space_mb = 0;
+            bool v8_expose_gc = false;
+            std::vector<std::string> v8_flags;
         };
 
         static File_Manager& Instance();
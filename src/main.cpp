@@ -32,6 +32,7 @@
 
 #define SAMP_SDK_IMPLEMENTATION
 #define SAMP_SDK_WANT_PROCESS_TICK
+#define SAMP_SDK_WANT_AMX_EVENTS
 #include "sdk/samp_sdk.hpp"
 //
 #include "constants.hpp"
@@ -44,6 +45,7 @@
 #include "logger.hpp"
 #include "exceptions.hpp"
 #include "native_hooks.hpp"
+#include "public_registry.hpp"
 
 unsigned int GetSupportFlags() {
     return SUPPORTS_VERSION;
@@ -70,6 +72,7 @@ bool OnLoad() {
             return (Logger::Log(Log_Level::ERROR_s, "Failed to initialize 'Runtime Manager'."), false);
 
         Event_Dispatcher::Instance().Generate_Hook_Bindings();
+        Event_Dispatcher::Instance().Generate_Registry_Bindings();
 
         if (!Runtime_Manager::Instance().Execute_Bootstrap_Script()) {
             Logger::Log(Log_Level::ERROR_s, "Failed to execute bootstrap scripts.");
@@ -100,7 +103,10 @@ void OnUnload() {
 
         Native_Hooks::Instance().Clear();
         Natives::Clear_Bindings();
+        Public_Registry::Instance().Clear();
         Runtime_Manager::Instance().Shutdown();
+        // Bound publics hold raw pointers to their handles, so these may only be freed once the isolate is gone.
+        Publics::Clear_Handles();
 
         Logger::Log(Log_Level::INFO, "Plugin unloaded successfully.");
     }
@@ -109,6 +115,14 @@ void OnUnload() {
     }
 }
 
+void OnAmxLoad(AMX* amx) {
+    Publics::Invalidate_Handles();
+}
+
+void OnAmxUnload(AMX* amx) {
+    Publics::Invalidate_Handles();
+}
+
 void OnProcessTick() {
     try {
         Runtime_Manager::Instance().Process_Tick();
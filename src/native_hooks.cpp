@@ -33,6 +33,7 @@
 #include "native_hooks.hpp"
 #include "error_handler.hpp"
 #include "natives.hpp"
+#include "constants.hpp"
 
 Native_Hooks& Native_Hooks::Instance() {
     static Native_Hooks instance;
@@ -44,34 +45,41 @@ void Native_Hooks::Register_Hook(v8::Isolate* isolate, const std::string& native
     if (!isolate || callback.IsEmpty())
         return;
 
-    auto entry = std::make_shared<Hook_Entry>(isolate, callback);
-    hooks_[native_name].push_back(entry);
-    
-    if (hooks_.size() == 1 && hooks_[native_name].size() == 1)
-        Natives::Set_Has_Hooks(true);
+    Native_Hook_Chain& chain = hooks_[native_name];
+    chain.callbacks.emplace_back(isolate, callback);
+
+    if (chain.callbacks.size() == 1)
+        Natives::Attach_Hooks(native_name, &chain);
 }
 
-bool Native_Hooks::Dispatch(v8::Isolate* isolate, const std::string& native_name, const v8::FunctionCallbackInfo<v8::Value>& info) {
+Native_Hook_Chain* Native_Hooks::Find_Chain(const std::string& native_name) {
     auto it = hooks_.find(native_name);
-    
-    if (it == hooks_.end() || it->second.empty())
-        return true;
 
-    const auto& callbacks = it->second;
+    return (it != hooks_.end() && !it->second.callbacks.empty()) ? &it->second : nullptr;
+}
+
+bool Native_Hooks::Dispatch(v8::Isolate* isolate, Native_Hook_Chain& chain, const v8::FunctionCallbackInfo<v8::Value>& info) {
     v8::Local<v8::Context> context = isolate->GetCurrentContext();
     v8::Local<v8::Object> global = context->Global();
 
     int argc = info.Length();
-    std::vector<v8::Local<v8::Value>> args(argc);
+    v8::Local<v8::Value> args_stack[Constants::STACK_ARGS_THRESHOLD];
+    std::vector<v8::Local<v8::Value>> args_heap;
+    v8::Local<v8::Value>* args = args_stack;
+
+    if (argc > static_cast<int>(Constants::STACK_ARGS_THRESHOLD)) {
+        args_heap.resize(argc);
+        args = args_heap.data();
+    }
 
     for (int i = 0; i < argc; i++)
         args[i] = info[i];
 
-    for (auto rit = callbacks.rbegin(); rit != callbacks.rend(); ++rit) {
-        v8::Local<v8::Function> hook_fn = (*rit)->callback.Get(isolate);
+    for (size_t i = chain.callbacks.size(); i-- > 0;) {
+        v8::Local<v8::Function> hook_fn = chain.callbacks[i].Get(isolate);
         
         v8::TryCatch try_catch(isolate);
-        v8::MaybeLocal<v8::Value> result_maybe = hook_fn->Call(context, global, argc, args.data());
+        v8::MaybeLocal<v8::Value> result_maybe = hook_fn->Call(context, global, argc, args);
 
         if (try_catch.HasCaught()) {
             Error_Handler::Log_Exception(isolate, try_catch);
@@ -91,12 +99,12 @@ bool Native_Hooks::Dispatch(v8::Isolate* isolate, const std::string& native_name
 }
 
 void Native_Hooks::Clear() {
+    Natives::Detach_Hooks();
+
     for (auto& pair : hooks_) {
-        for (auto& entry : pair.second)
-            entry->callback.Reset();
+        for (auto& callback : pair.second.callbacks)
+            callback.Reset();
     }
 
     hooks_.clear();
-    
-    Natives::Set_Has_Hooks(false);
 }
\ No newline at end of file
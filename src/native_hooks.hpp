@@ -35,16 +35,20 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
-#include <memory>
 //
 #include "node_inclusion.hpp"
 
+struct Native_Hook_Chain {
+    std::vector<v8::Global<v8::Function>> callbacks;
+};
+
 class Native_Hooks {
     public:
         static Native_Hooks& Instance();
 
         void Register_Hook(v8::Isolate* isolate, const std::string& native_name, v8::Local<v8::Function> callback);
-        bool Dispatch(v8::Isolate* isolate, const std::string& native_name, const v8::FunctionCallbackInfo<v8::Value>& info);
+        Native_Hook_Chain* Find_Chain(const std::string& native_name);
+        bool Dispatch(v8::Isolate* isolate, Native_Hook_Chain& chain, const v8::FunctionCallbackInfo<v8::Value>& info);
         void Clear();
 
     private:
@@ -54,13 +58,5 @@ class Native_Hooks {
         Native_Hooks(const Native_Hooks&) = delete;
         Native_Hooks& operator=(const Native_Hooks&) = delete;
 
-        struct Hook_Entry {
-            v8::Persistent<v8::Function> callback;
-            
-            Hook_Entry(v8::Isolate* isolate, v8::Local<v8::Function> fn) {
-                callback.Reset(isolate, fn);
-            }
-        };
-
-        std::unordered_map<std::string, std::vector<std::shared_ptr<Hook_Entry>>> hooks_;
+        std::unordered_map<std::string, Native_Hook_Chain> hooks_;
 };
\ No newline at end of file
@@ -0,0 +1,472 @@
+/* ============================================================================ *
+ * Kainure - Node.js Framework for SA-MP (San Andreas Multiplayer)              *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * Kainure embeds Node.js runtime into SA-MP servers, enabling developers       *
+ * to write gamemodes using modern JavaScript/TypeScript with full access       *
+ * to the Node.js ecosystem, async/await, npm packages, and native SA-MP        *
+ * functions through automatic bindings.                                        *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/kainure                          *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the Apache License, Version 2.0 (the "License");              *
+ * you may not use this file except in compliance with the License.             *
+ * You may obtain a copy of the License at:                                     *
+ *                                                                              *
+ *     http://www.apache.org/licenses/LICENSE-2.0                               *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <iterator>
+//
+#include "native_signatures.hpp"
+#include "constants.hpp"
+
+namespace {
+    constexpr std::string_view READ_ONLY_PREFIXES[] = { "Get", "Is", "NetStats_" };
+    constexpr std::string_view PURE_NATIVES[] = { "asin", "acos", "atan", "atan2", "VectorSize" };
+
+    // Declared parameter and return types of the stock SA-MP natives. Read-only natives
+    // (see 'Is_Fast_Eligible') that only take integers and floats by value are also bound
+    // through the V8 fast API.
+    constexpr Native_Signature SIGNATURE_TABLE[] = {
+        // a_samp
+        { "SendDeathMessage", "iii" },
+        { "SendDeathMessageToPlayer", "iiii" },
+        { "GetTickCount", "" },
+        { "GetMaxPlayers", "" },
+        { "GetPlayerPoolSize", "" },
+        { "GetVehiclePoolSize", "" },
+        { "GetActorPoolSize", "" },
+        { "GetServerTickRate", "" },
+        { "GetGravity", "", 'f' },
+        { "VectorSize", "fff", 'f' },
+        { "asin", "f", 'f' },
+        { "acos", "f", 'f' },
+        { "atan", "f", 'f' },
+        { "atan2", "ff", 'f' },
+        { "SendClientMessage", "iis" },
+        { "SendClientMessageToAll", "is" },
+        { "SendPlayerMessageToPlayer", "iis" },
+        { "SendPlayerMessageToAll", "is" },
+        { "GameTextForAll", "sii" },
+        { "GameTextForPlayer", "isii" },
+        { "SetGameModeText", "s" },
+        { "SendRconCommand", "s" },
+        { "GetWeaponName", "iSi" },
+        { "GetPlayerNetworkStats", "iSi" },
+        { "GetNetworkStats", "Si" },
+        { "NetStats_PacketLossPercent", "i", 'f' },
+        { "NetStats_GetIpPort", "iSi" },
+        { "GetServerVarAsString", "sSi" },
+        { "GetServerVarAsInt", "s" },
+        { "GetServerVarAsBool", "s" },
+        { "GetConsoleVarAsString", "sSi" },
+        { "GetConsoleVarAsInt", "s" },
+        { "GetConsoleVarAsBool", "s" },
+        { "ShowPlayerDialog", "iiissss" },
+        { "Create3DTextLabel", "siffffii" },
+        { "Update3DTextLabelText", "iis" },
+        { "CreatePlayer3DTextLabel", "isiffffiii" },
+        { "UpdatePlayer3DTextLabelText", "iiis" },
+        { "GetActorPos", "iFFF" },
+        { "GetActorFacingAngle", "iF" },
+        { "GetActorHealth", "iF" },
+        { "ApplyActorAnimation", "issfiiiii" },
+        { "SetTeamCount", "i" },
+        { "AddPlayerClass", "iffffiiiiii" },
+        { "AddPlayerClassEx", "iiffffiiiiii" },
+        { "AddStaticVehicle", "iffffii" },
+        { "AddStaticVehicleEx", "iffffiiii" },
+        { "AddStaticPickup", "iifffi" },
+        { "CreatePickup", "iifffi" },
+        { "DestroyPickup", "i" },
+        { "ShowNameTags", "i" },
+        { "ShowPlayerMarkers", "i" },
+        { "SetWorldTime", "i" },
+        { "AllowInteriorWeapons", "i" },
+        { "SetWeather", "i" },
+        { "SetGravity", "f" },
+        { "AllowAdminTeleport", "i" },
+        { "SetDeathDropAmount", "i" },
+        { "CreateExplosion", "fffif" },
+        { "EnableTirePopping", "i" },
+        { "EnableVehicleFriendlyFire", "" },
+        { "EnableZoneNames", "i" },
+        { "UsePlayerPedAnims", "" },
+        { "DisableInteriorEnterExits", "" },
+        { "SetNameTagDrawDistance", "f" },
+        { "DisableNameTagLOS", "" },
+        { "LimitGlobalChatRadius", "f" },
+        { "LimitPlayerMarkerRadius", "f" },
+        { "EnableStuntBonusForAll", "i" },
+        { "IsPlayerNPC", "i" },
+        { "IsPlayerAdmin", "i" },
+        { "NetStats_GetConnectedTime", "i" },
+        { "NetStats_MessagesReceived", "i" },
+        { "NetStats_BytesReceived", "i" },
+        { "NetStats_MessagesSent", "i" },
+        { "NetStats_BytesSent", "i" },
+        { "NetStats_MessagesRecvPerSecond", "i" },
+        { "NetStats_ConnectionStatus", "i" },
+        { "DestroyMenu", "i" },
+        { "ShowMenuForPlayer", "ii" },
+        { "HideMenuForPlayer", "ii" },
+        { "IsValidMenu", "i" },
+        { "DisableMenu", "i" },
+        { "DisableMenuRow", "ii" },
+        { "GetPlayerMenu", "i" },
+        { "TextDrawDestroy", "i" },
+        { "TextDrawLetterSize", "iff" },
+        { "TextDrawTextSize", "iff" },
+        { "TextDrawAlignment", "ii" },
+        { "TextDrawColor", "ii" },
+        { "TextDrawUseBox", "ii" },
+        { "TextDrawBoxColor", "ii" },
+        { "TextDrawSetShadow", "ii" },
+        { "TextDrawSetOutline", "ii" },
+        { "TextDrawBackgroundColor", "ii" },
+        { "TextDrawFont", "ii" },
+        { "TextDrawSetProportional", "ii" },
+        { "TextDrawSetSelectable", "ii" },
+        { "TextDrawShowForPlayer", "ii" },
+        { "TextDrawHideForPlayer", "ii" },
+        { "TextDrawShowForAll", "i" },
+        { "TextDrawHideForAll", "i" },
+        { "TextDrawSetPreviewModel", "ii" },
+        { "TextDrawSetPreviewRot", "iffff" },
+        { "TextDrawSetPreviewVehCol", "iii" },
+        { "PlayerTextDrawDestroy", "ii" },
+        { "PlayerTextDrawLetterSize", "iiff" },
+        { "PlayerTextDrawTextSize", "iiff" },
+        { "PlayerTextDrawAlignment", "iii" },
+        { "PlayerTextDrawColor", "iii" },
+        { "PlayerTextDrawUseBox", "iii" },
+        { "PlayerTextDrawBoxColor", "iii" },
+        { "PlayerTextDrawSetShadow", "iii" },
+        { "PlayerTextDrawSetOutline", "iii" },
+        { "PlayerTextDrawBackgroundColor", "iii" },
+        { "PlayerTextDrawFont", "iii" },
+        { "PlayerTextDrawSetProportional", "iii" },
+        { "PlayerTextDrawSetSelectable", "iii" },
+        { "PlayerTextDrawShow", "ii" },
+        { "PlayerTextDrawHide", "ii" },
+        { "PlayerTextDrawSetPreviewModel", "iii" },
+        { "PlayerTextDrawSetPreviewRot", "iiffff" },
+        { "PlayerTextDrawSetPreviewVehCol", "iiii" },
+        { "TextDrawCreate", "ffs" },
+        { "TextDrawSetString", "is" },
+        { "CreatePlayerTextDraw", "iffs" },
+        { "PlayerTextDrawSetString", "iis" },
+        { "SelectTextDraw", "ii" },
+        { "CancelSelectTextDraw", "i" },
+        { "GangZoneCreate", "ffff" },
+        { "GangZoneDestroy", "i" },
+        { "GangZoneShowForPlayer", "iii" },
+        { "GangZoneShowForAll", "ii" },
+        { "GangZoneHideForPlayer", "ii" },
+        { "GangZoneHideForAll", "i" },
+        { "GangZoneFlashForPlayer", "iii" },
+        { "GangZoneFlashForAll", "ii" },
+        { "GangZoneStopFlashForPlayer", "ii" },
+        { "GangZoneStopFlashForAll", "i" },
+        { "Delete3DTextLabel", "i" },
+        { "Attach3DTextLabelToPlayer", "iifff" },
+        { "Attach3DTextLabelToVehicle", "iifff" },
+        { "DeletePlayer3DTextLabel", "ii" },
+        { "CreateActor", "iffff" },
+        { "DestroyActor", "i" },
+        { "IsActorStreamedIn", "ii" },
+        { "SetActorVirtualWorld", "ii" },
+        { "GetActorVirtualWorld", "i" },
+        { "ClearActorAnimations", "i" },
+        { "SetActorPos", "ifff" },
+        { "SetActorFacingAngle", "if" },
+        { "SetActorHealth", "if" },
+        { "SetActorInvulnerable", "ii" },
+        { "IsActorInvulnerable", "i" },
+        { "IsValidActor", "i" },
+
+        // a_players
+        { "SetPlayerTeam", "ii" },
+        { "GetPlayerTeam", "i" },
+        { "SetPlayerPos", "ifff" },
+        { "SetPlayerPosFindZ", "ifff" },
+        { "SetPlayerFacingAngle", "if" },
+        { "GetPlayerPos", "iFFF" },
+        { "GetPlayerFacingAngle", "iF" },
+        { "GetPlayerDistanceFromPoint", "ifff", 'f' },
+        { "GetPlayerHealth", "iF" },
+        { "GetPlayerArmour", "iF" },
+        { "GetPlayerVelocity", "iFFF" },
+        { "GetPlayerName", "iSi" },
+        { "SetPlayerName", "is" },
+        { "GetPlayerIp", "iSi" },
+        { "GetPlayerVersion", "iSi" },
+        { "GetPlayerKeys", "iIII" },
+        { "GetPlayerTime", "iII" },
+        { "GetPlayerWeaponData", "iiII" },
+        { "GetPlayerLastShotVectors", "iFFFFFF" },
+        { "GetPlayerCameraPos", "iFFF" },
+        { "GetPlayerCameraFrontVector", "iFFF" },
+        { "GetPlayerCameraAspectRatio", "i", 'f' },
+        { "GetPlayerCameraZoom", "i", 'f' },
+        { "GetPlayerObjectPos", "iiFFF" },
+        { "GetPlayerObjectRot", "iiFFF" },
+        { "SetPlayerChatBubble", "isifi" },
+        { "ApplyAnimation", "issfiiiiii" },
+        { "GetAnimationName", "iSiSi" },
+        { "PlayAudioStreamForPlayer", "isffffi" },
+        { "SetPVarInt", "isi" },
+        { "GetPVarInt", "is" },
+        { "SetPVarString", "iss" },
+        { "GetPVarString", "isSi" },
+        { "SetPVarFloat", "isf" },
+        { "GetPVarFloat", "is", 'f' },
+        { "DeletePVar", "is" },
+        { "GetPVarType", "is" },
+        { "IsPlayerInRangeOfPoint", "iffff" },
+        { "IsPlayerStreamedIn", "ii" },
+        { "SetPlayerInterior", "ii" },
+        { "GetPlayerInterior", "i" },
+        { "SetPlayerHealth", "if" },
+        { "SetPlayerArmour", "if" },
+        { "SetPlayerAmmo", "iii" },
+        { "GetPlayerAmmo", "i" },
+        { "GetPlayerWeaponState", "i" },
+        { "GetPlayerTargetPlayer", "i" },
+        { "GetPlayerTargetActor", "i" },
+        { "SetPlayerColor", "ii" },
+        { "GetPlayerColor", "i" },
+        { "SetPlayerSkin", "ii" },
+        { "GetPlayerSkin", "i" },
+        { "GivePlayerWeapon", "iii" },
+        { "ResetPlayerWeapons", "i" },
+        { "SetPlayerArmedWeapon", "ii" },
+        { "GivePlayerMoney", "ii" },
+        { "ResetPlayerMoney", "i" },
+        { "GetPlayerMoney", "i" },
+        { "GetPlayerState", "i" },
+        { "GetPlayerPing", "i" },
+        { "GetPlayerWeapon", "i" },
+        { "SetPlayerScore", "ii" },
+        { "GetPlayerScore", "i" },
+        { "SetPlayerDrunkLevel", "ii" },
+        { "GetPlayerDrunkLevel", "i" },
+        { "SetPlayerWantedLevel", "ii" },
+        { "GetPlayerWantedLevel", "i" },
+        { "SetPlayerFightingStyle", "ii" },
+        { "GetPlayerFightingStyle", "i" },
+        { "SetPlayerVelocity", "ifff" },
+        { "PlayCrimeReportForPlayer", "iii" },
+        { "StopAudioStreamForPlayer", "i" },
+        { "SetPlayerSkillLevel", "iii" },
+        { "GetPlayerSurfingVehicleID", "i" },
+        { "GetPlayerSurfingObjectID", "i" },
+        { "RemoveBuildingForPlayer", "iiffff" },
+        { "SetPlayerAttachedObject", "iiiifffffffffii" },
+        { "RemovePlayerAttachedObject", "ii" },
+        { "IsPlayerAttachedObjectSlotUsed", "ii" },
+        { "EditAttachedObject", "ii" },
+        { "PutPlayerInVehicle", "iii" },
+        { "GetPlayerVehicleID", "i" },
+        { "GetPlayerVehicleSeat", "i" },
+        { "RemovePlayerFromVehicle", "i" },
+        { "TogglePlayerControllable", "ii" },
+        { "PlayerPlaySound", "iifff" },
+        { "ClearAnimations", "ii" },
+        { "GetPlayerAnimationIndex", "i" },
+        { "GetPlayerSpecialAction", "i" },
+        { "SetPlayerSpecialAction", "ii" },
+        { "DisableRemoteVehicleCollisions", "ii" },
+        { "SetPlayerCheckpoint", "iffff" },
+        { "DisablePlayerCheckpoint", "i" },
+        { "SetPlayerRaceCheckpoint", "iifffffff" },
+        { "DisablePlayerRaceCheckpoint", "i" },
+        { "SetPlayerWorldBounds", "iffff" },
+        { "SetPlayerMarkerForPlayer", "iii" },
+        { "ShowPlayerNameTagForPlayer", "iii" },
+        { "SetPlayerMapIcon", "iifffiii" },
+        { "RemovePlayerMapIcon", "ii" },
+        { "AllowPlayerTeleport", "ii" },
+        { "SetPlayerCameraPos", "ifff" },
+        { "SetPlayerCameraLookAt", "ifffi" },
+        { "SetCameraBehindPlayer", "i" },
+        { "GetPlayerCameraMode", "i" },
+        { "EnablePlayerCameraTarget", "ii" },
+        { "GetPlayerCameraTargetObject", "i" },
+        { "GetPlayerCameraTargetVehicle", "i" },
+        { "GetPlayerCameraTargetPlayer", "i" },
+        { "GetPlayerCameraTargetActor", "i" },
+        { "AttachCameraToObject", "ii" },
+        { "AttachCameraToPlayerObject", "ii" },
+        { "InterpolateCameraPos", "iffffffii" },
+        { "InterpolateCameraLookAt", "iffffffii" },
+        { "IsPlayerConnected", "i" },
+        { "IsPlayerInVehicle", "ii" },
+        { "IsPlayerInAnyVehicle", "i" },
+        { "IsPlayerInCheckpoint", "i" },
+        { "IsPlayerInRaceCheckpoint", "i" },
+        { "SetPlayerVirtualWorld", "ii" },
+        { "GetPlayerVirtualWorld", "i" },
+        { "EnableStuntBonusForPlayer", "ii" },
+        { "PlayerSpectatePlayer", "iii" },
+        { "PlayerSpectateVehicle", "iii" },
+        { "StopRecordingPlayerData", "i" },
+        { "CreateExplosionForPlayer", "ifffif" },
+        { "SetPlayerTime", "iii" },
+        { "TogglePlayerClock", "ii" },
+        { "SetPlayerWeather", "ii" },
+        { "ForceClassSelection", "i" },
+
+        // a_vehicles
+        { "CreateVehicle", "iffffiiii" },
+        { "DestroyVehicle", "i" },
+        { "IsVehicleStreamedIn", "ii" },
+        { "SetVehiclePos", "ifff" },
+        { "SetVehicleZAngle", "if" },
+        { "GetVehiclePos", "iFFF" },
+        { "GetVehicleZAngle", "iF" },
+        { "GetVehicleRotationQuat", "iFFFF" },
+        { "GetVehicleDistanceFromPoint", "ifff", 'f' },
+        { "GetVehicleHealth", "iF" },
+        { "GetVehicleVelocity", "iFFF" },
+        { "GetVehicleParamsEx", "iIIIIIII" },
+        { "GetVehicleParamsCarDoors", "iIIII" },
+        { "GetVehicleParamsCarWindows", "iIIII" },
+        { "GetVehicleDamageStatus", "iIIII" },
+        { "GetVehicleModelInfo", "iiFFF" },
+        { "SetVehicleNumberPlate", "is" },
+        { "SetVehicleParamsForPlayer", "iiii" },
+        { "ManualVehicleEngineAndLights", "" },
+        { "SetVehicleParamsEx", "iiiiiiii" },
+        { "SetVehicleParamsCarDoors", "iiiii" },
+        { "SetVehicleParamsCarWindows", "iiiii" },
+        { "GetVehicleParamsSirenState", "i" },
+        { "SetVehicleToRespawn", "i" },
+        { "LinkVehicleToInterior", "ii" },
+        { "AddVehicleComponent", "ii" },
+        { "RemoveVehicleComponent", "ii" },
+        { "ChangeVehicleColor", "iii" },
+        { "ChangeVehiclePaintjob", "ii" },
+        { "SetVehicleHealth", "if" },
+        { "AttachTrailerToVehicle", "ii" },
+        { "DetachTrailerFromVehicle", "i" },
+        { "IsTrailerAttachedToVehicle", "i" },
+        { "GetVehicleTrailer", "i" },
+        { "GetVehicleModel", "i" },
+        { "GetVehicleComponentInSlot", "ii" },
+        { "GetVehicleComponentType", "i" },
+        { "RepairVehicle", "i" },
+        { "SetVehicleVelocity", "ifff" },
+        { "SetVehicleAngularVelocity", "ifff" },
+        { "UpdateVehicleDamageStatus", "iiiii" },
+        { "SetVehicleVirtualWorld", "ii" },
+        { "GetVehicleVirtualWorld", "i" },
+
+        // a_objects
+        { "CreateObject", "ifffffff" },
+        { "AttachObjectToVehicle", "iiffffff" },
+        { "AttachObjectToObject", "iiffffffi" },
+        { "AttachObjectToPlayer", "iiffffff" },
+        { "SetObjectPos", "ifff" },
+        { "SetObjectRot", "ifff" },
+        { "GetObjectPos", "iFFF" },
+        { "GetObjectRot", "iFFF" },
+        { "IsValidObject", "i" },
+        { "DestroyObject", "i" },
+        { "MoveObject", "ifffffff" },
+        { "StopObject", "i" },
+        { "IsObjectMoving", "i" },
+        { "EditObject", "ii" },
+        { "EditPlayerObject", "ii" },
+        { "SelectObject", "i" },
+        { "CancelEdit", "i" },
+        { "CreatePlayerObject", "iifffffff" },
+        { "AttachPlayerObjectToVehicle", "iiiffffff" },
+        { "AttachPlayerObjectToPlayer", "iiiffffff" },
+        { "SetPlayerObjectPos", "iifff" },
+        { "SetPlayerObjectRot", "iifff" },
+        { "IsValidPlayerObject", "ii" },
+        { "DestroyPlayerObject", "ii" },
+        { "MovePlayerObject", "iifffffff" },
+        { "StopPlayerObject", "ii" },
+        { "IsPlayerObjectMoving", "ii" },
+        { "SetObjectsDefaultCameraCol", "i" },
+        { "SetObjectNoCameraCol", "i" },
+        { "SetPlayerObjectNoCameraCol", "ii" },
+    };
+
+    const std::unordered_map<std::string_view, const Native_Signature*>& Get_Signature_Index() {
+        static const std::unordered_map<std::string_view, const Native_Signature*> index = [] {
+            std::unordered_map<std::string_view, const Native_Signature*> map;
+            map.reserve(std::size(SIGNATURE_TABLE));
+
+            for (const Native_Signature& signature : SIGNATURE_TABLE)
+                map.emplace(signature.name, &signature);
+
+            return map;
+        }();
+
+        return index;
+    }
+}
+
+const Native_Signature* Native_Signatures::Find(std::string_view name) {
+    const auto& index = Get_Signature_Index();
+    auto it = index.find(name);
+
+    return it != index.end() ? it->second : nullptr;
+}
+
+size_t Native_Signatures::Get_Param_Count(const Native_Signature& signature) {
+    return std::char_traits<char>::length(signature.params);
+}
+
+bool Native_Signatures::Is_Value_Only(const Native_Signature& signature) {
+    for (const char* type = signature.params; *type; ++type) {
+        if (*type != Constants::SIGNATURE_TYPE_INTEGER && *type != Constants::SIGNATURE_TYPE_FLOAT)
+            return false;
+    }
+
+    return true;
+}
+
+bool Native_Signatures::Is_Read_Only(const Native_Signature& signature) {
+    std::string_view name = signature.name;
+
+    for (std::string_view prefix : READ_ONLY_PREFIXES) {
+        if (name.substr(0, prefix.size()) == prefix)
+            return true;
+    }
+
+    for (std::string_view pure : PURE_NATIVES) {
+        if (name == pure)
+            return true;
+    }
+
+    return false;
+}
+
+// The fast API cannot call back into JavaScript, so only natives that merely read server state qualify. Setters
+// may raise publics, either on the stock server or through a plugin hooking them, and stay on the regular path.
+bool Native_Signatures::Is_Fast_Eligible(const Native_Signature& signature) {
+    return Is_Read_Only(signature) && Get_Param_Count(signature) <= Constants::FAST_API_MAX_ARGS && Is_Value_Only(signature);
+}
\ No newline at end of file
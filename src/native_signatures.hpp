@@ -0,0 +1,54 @@
+/* ============================================================================ *
+ * Kainure - Node.js Framework for SA-MP (San Andreas Multiplayer)              *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * Kainure embeds Node.js runtime into SA-MP servers, enabling developers       *
+ * to write gamemodes using modern JavaScript/TypeScript with full access       *
+ * to the Node.js ecosystem, async/await, npm packages, and native SA-MP        *
+ * functions through automatic bindings.                                        *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/kainure                          *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the Apache License, Version 2.0 (the "License");              *
+ * you may not use this file except in compliance with the License.             *
+ * You may obtain a copy of the License at:                                     *
+ *                                                                              *
+ *     http://www.apache.org/licenses/LICENSE-2.0                               *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <string_view>
+#include <cstddef>
+//
+#include "constants.hpp"
+
+struct Native_Signature {
+    const char* name;
+    const char* params;
+    char return_type = Constants::SIGNATURE_TYPE_INTEGER;
+};
+
+class Native_Signatures {
+    public:
+        static const Native_Signature* Find(std::string_view name);
+        static bool Is_Value_Only(const Native_Signature& signature);
+        static bool Is_Read_Only(const Native_Signature& signature);
+        static bool Is_Fast_Eligible(const Native_Signature& signature);
+        static size_t Get_Param_Count(const Native_Signature& signature);
+};
\ No newline at end of file
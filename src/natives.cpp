@@ -30,14 +30,20 @@
  *                                                                              *
  * ============================================================================ */
 
-#include <atomic>
+#include <algorithm>
+#include <string>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
 //
+#include "sdk/amx/amx_api.hpp"
 #include "sdk/amx/amx_defs.h"
 #include "sdk/hooks/interceptor_manager.hpp"
 #include "sdk/events/callbacks.hpp"
 #include "sdk/core/platform.hpp"
 //
 #include "natives.hpp"
+#include "amx_arena.hpp"
 #include "native_hooks.hpp"
 #include "type_converter.hpp"
 #include "logger.hpp"
@@ -45,10 +51,9 @@
 #include "constants.hpp"
 
 std::vector<std::unique_ptr<Native_Binding_Data>> Natives::bindings_storage_;
+std::unordered_map<std::string, uint32_t> Natives::binding_ids_;
 
 namespace {
-    std::atomic<bool> has_any_hooks { false };
-
     struct Lazy_Sandbox {
         Samp_SDK::Detail::Amx_Sandbox sandbox;
         bool initialized = false;
@@ -62,7 +67,6 @@ namespace {
             }
             else {
                 sandbox.amx.stk = sandbox.amx.stp;
-                sandbox.amx.hea = 0;
                 sandbox.amx.paramcount = 0;
             }
 
@@ -71,6 +75,84 @@ namespace {
     };
 
     static thread_local Lazy_Sandbox tl_sandbox;
+    static thread_local bool tl_in_fast_call = false;
+
+    template<size_t>
+    using Fast_Arg = double;
+
+    template<typename Return, typename Sequence>
+    struct Fast_Native;
+
+    template<typename Return, size_t... I>
+    struct Fast_Native<Return, std::index_sequence<I...>> {
+        static Return Call(v8::Local<v8::Object> receiver, Fast_Arg<I>... args, v8::FastApiCallbackOptions& options) {
+            Native_Binding_Data* data = static_cast<Native_Binding_Data*>(options.data.As<v8::External>()->Value());
+
+            if (data->hooks)
+                return (options.fallback = true, Return{});
+
+            const double values[sizeof...(I) + 1] = { args..., 0.0 };
+            cell params[sizeof...(I) + 1];
+
+            params[0] = static_cast<cell>(sizeof...(I) * sizeof(cell));
+
+            for (size_t i = 0; i < sizeof...(I); i++) {
+                if (data->signature->params[i] == Constants::SIGNATURE_TYPE_FLOAT) {
+                    params[i + 1] = Samp_SDK::amx::AMX_FTOC(static_cast<float>(values[i]));
+
+                    continue;
+                }
+
+                if (!(values[i] >= static_cast<double>(INT32_MIN) && values[i] <= static_cast<double>(INT32_MAX)))
+                    return (options.fallback = true, Return{});
+
+                params[i + 1] = static_cast<cell>(values[i]);
+            }
+
+            tl_in_fast_call = true;
+            cell retval = data->native_func(tl_sandbox.Get(), params);
+            tl_in_fast_call = false;
+
+            if constexpr (std::is_same_v<Return, double>)
+                return Samp_SDK::amx::AMX_CTOF(retval);
+            else
+                return retval;
+        }
+
+        static v8::CFunction Make() {
+            return v8::CFunction::Make(Call);
+        }
+    };
+
+    template<typename Return, size_t... N>
+    const v8::CFunction* Get_Fast_Function(size_t argc, std::index_sequence<N...>) {
+        static const v8::CFunction functions[] = { Fast_Native<Return, std::make_index_sequence<N>>::Make()... };
+
+        return argc < sizeof...(N) ? &functions[argc] : nullptr;
+    }
+
+    size_t Get_Ref_Run(const char* types) {
+        size_t run = 0;
+
+        while (types[run] == Constants::SIGNATURE_TYPE_INT_REF || types[run] == Constants::SIGNATURE_TYPE_FLOAT_REF)
+            ++run;
+
+        return run;
+    }
+
+    void Throw_Range_Error(v8::Isolate* isolate, const std::string& message) {
+        isolate->ThrowException(v8::Exception::RangeError(v8::String::NewFromUtf8(isolate, message.c_str()).ToLocalChecked()));
+    }
+
+    SAMP_SDK_FORCE_INLINE char Get_Param_Type(const Native_Binding_Data* data, int index) {
+        return static_cast<size_t>(index) < data->param_count ? data->signature->params[index] : '\0';
+    }
+
+    SAMP_SDK_FORCE_INLINE void Set_Return(const v8::FunctionCallbackInfo<v8::Value>& info, v8::Isolate* isolate, const Native_Binding_Data* data, cell retval) {
+        char return_type = data->signature ? data->signature->return_type : Constants::SIGNATURE_TYPE_INTEGER;
+
+        info.GetReturnValue().Set(Type_Converter::From_Native_Return(isolate, retval, return_type));
+    }
 }
 
 void Natives::Generate_Binding(v8::Isolate* isolate, v8::Local<v8::Object> target, const std::string& name, uint32_t hash) {
@@ -96,12 +178,29 @@ void Natives::Generate_Binding(v8::Isolate* isolate, v8::Local<v8::Object> targe
         data->native_func = native_func;
         data->native_hash = hash;
         data->native_name = name;
+        data->signature = Native_Signatures::Find(name);
+        data->param_count = data->signature ? Native_Signatures::Get_Param_Count(*data->signature) : 0;
+        data->hooks = Native_Hooks::Instance().Find_Chain(name);
+
+        const v8::CFunction* fast_function = nullptr;
+
+        if (data->signature && Native_Signatures::Is_Fast_Eligible(*data->signature)) {
+            auto arities = std::make_index_sequence<Constants::FAST_API_MAX_ARGS + 1>();
+
+            if (data->signature->return_type == Constants::SIGNATURE_TYPE_FLOAT)
+                fast_function = Get_Fast_Function<double>(data->param_count, arities);
+            else
+                fast_function = Get_Fast_Function<int32_t>(data->param_count, arities);
+        }
+
+        data->id = static_cast<uint32_t>(bindings_storage_.size());
 
         v8::Local<v8::External> external_data = v8::External::New(isolate, data.get());
 
+        binding_ids_[name] = data->id;
         bindings_storage_.push_back(std::move(data));
 
-        v8::Local<v8::FunctionTemplate> tpl = v8::FunctionTemplate::New(isolate, Handler, external_data);
+        v8::Local<v8::FunctionTemplate> tpl = v8::FunctionTemplate::New(isolate, Handler, external_data, v8::Local<v8::Signature>(), 0, v8::ConstructorBehavior::kAllow, v8::SideEffectType::kHasSideEffect, fast_function);
         v8::Local<v8::Function> fn;
 
         if (!tpl->GetFunction(context).ToLocal(&fn))
@@ -111,7 +210,7 @@ void Natives::Generate_Binding(v8::Isolate* isolate, v8::Local<v8::Object> targe
 
         fn->SetName(fn_name);
 
-        if (!target->Set(context, fn_name, fn).FromMaybe(false))
+        if (!target->CreateDataProperty(context, fn_name, fn).FromMaybe(false))
             Logger::Log(Log_Level::WARNING, "Failed to set native function '%s' on target object.", name.c_str());
     }
     catch (const V8_Exception& e) {
@@ -122,12 +221,135 @@ void Natives::Generate_Binding(v8::Isolate* isolate, v8::Local<v8::Object> targe
     }
 }
 
+void Natives::Generate_Batch_Bindings(v8::Isolate* isolate, v8::Local<v8::Context> context) {
+    v8::Local<v8::Object> global = context->Global();
+    v8::Local<v8::Function> fn;
+
+    if (v8::Function::New(context, Resolve_Handler).ToLocal(&fn))
+        global->Set(context, v8::String::NewFromUtf8(isolate, Constants::JS_RESOLVE_NATIVE).ToLocalChecked(), fn).Check();
+
+    if (v8::Function::New(context, Batch_Handler).ToLocal(&fn))
+        global->Set(context, v8::String::NewFromUtf8(isolate, Constants::JS_EXECUTE_NATIVE_BATCH).ToLocalChecked(), fn).Check();
+}
+
 void Natives::Clear_Bindings() {
     bindings_storage_.clear();
+    binding_ids_.clear();
 }
 
-void Natives::Set_Has_Hooks(bool has_hooks) {
-    has_any_hooks.store(has_hooks, std::memory_order_relaxed);
+void Natives::Resolve_Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+
+    if (info.Length() < 1 || !info[0]->IsString())
+        return info.GetReturnValue().Set(-1);
+
+    v8::String::Utf8Value name(isolate, info[0]);
+    auto it = binding_ids_.find(*name ? *name : "");
+
+    if (it == binding_ids_.end())
+        return info.GetReturnValue().Set(-1);
+
+    const Native_Binding_Data* data = bindings_storage_[it->second].get();
+
+    // Batched arguments are marshalled purely by declared type, so natives without a signature cannot be batched either.
+    if (!data->signature || !Native_Signatures::Is_Value_Only(*data->signature))
+        return info.GetReturnValue().Set(-2);
+
+    info.GetReturnValue().Set(static_cast<int32_t>(it->second));
+}
+
+void Natives::Batch_Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+
+    try {
+        if (info.Length() < 4 || !info[0]->IsInt32Array() || !info[1]->IsFloat64Array() || !info[2]->IsFloat64Array() || !info[3]->IsInt32())
+            throw V8_Exception("Native batch expects (Int32Array ops, Float64Array args, Float64Array results, count).");
+
+        v8::Local<v8::Int32Array> ops_array = info[0].As<v8::Int32Array>();
+        v8::Local<v8::Float64Array> args_array = info[1].As<v8::Float64Array>();
+        v8::Local<v8::Float64Array> results_array = info[2].As<v8::Float64Array>();
+
+        const int32_t* ops = reinterpret_cast<const int32_t*>(static_cast<const uint8_t*>(ops_array->Buffer()->Data()) + ops_array->ByteOffset());
+        const double* args = reinterpret_cast<const double*>(static_cast<const uint8_t*>(args_array->Buffer()->Data()) + args_array->ByteOffset());
+        double* results = reinterpret_cast<double*>(static_cast<uint8_t*>(results_array->Buffer()->Data()) + results_array->ByteOffset());
+
+        size_t ops_length = ops_array->Length();
+        size_t args_length = args_array->Length();
+        size_t results_length = results_array->Length();
+        size_t count = static_cast<size_t>(std::max(info[3].As<v8::Int32>()->Value(), 0));
+
+        if (count * 2 > ops_length || count > results_length)
+            throw V8_Exception("Native batch count exceeds the size of its buffers.");
+
+        for (size_t call = 0; call < count; call++) {
+            uint32_t id = static_cast<uint32_t>(ops[call * 2]);
+
+            if (id < bindings_storage_.size() && bindings_storage_[id]->hooks)
+                return info.GetReturnValue().Set(-1);
+        }
+
+        AMX* amx_fake = tl_sandbox.Get();
+        cell params[Constants::STACK_BUFFER_SIZE];
+        size_t arg_pos = 0;
+
+        for (size_t call = 0; call < count; call++) {
+            uint32_t id = static_cast<uint32_t>(ops[call * 2]);
+            size_t argc = static_cast<size_t>(ops[call * 2 + 1]);
+
+            if (id >= bindings_storage_.size() || argc > Constants::STACK_ARGS_THRESHOLD || arg_pos + argc > args_length)
+                throw AMX_Exception("Invalid entry " + std::to_string(call) + " in native batch.");
+
+            const Native_Binding_Data* data = bindings_storage_[id].get();
+
+            // Every declared parameter is read by the native, so a short entry would hand it uninitialized cells.
+            if (!data->signature || !Native_Signatures::Is_Value_Only(*data->signature) || argc != data->param_count)
+                throw AMX_Exception("Entry " + std::to_string(call) + " in native batch passes " + std::to_string(argc) + " arguments to '" + data->native_name + "', which takes " + std::to_string(data->param_count) + ".");
+
+            params[0] = static_cast<cell>(argc * sizeof(cell));
+
+            for (size_t i = 0; i < argc; i++)
+                params[i + 1] = Type_Converter::Number_To_Cell(args[arg_pos + i], Get_Param_Type(data, static_cast<int>(i)));
+
+            arg_pos += argc;
+
+            cell retval = data->native_func(amx_fake, params);
+
+            if (data->signature && data->signature->return_type == Constants::SIGNATURE_TYPE_FLOAT)
+                results[call] = Samp_SDK::amx::AMX_CTOF(retval);
+            else
+                results[call] = retval;
+        }
+
+        info.GetReturnValue().Set(static_cast<int32_t>(count));
+    }
+    catch (const Plugin_Exception& e) {
+        Logger::Log(Log_Level::ERROR_s, "'%s'.", e.what());
+
+        if (isolate)
+            isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, e.what()).ToLocalChecked()));
+    }
+    catch (const std::exception& e) {
+        Logger::Log(Log_Level::ERROR_s, "Unexpected exception in native batch: '%s'.", e.what());
+
+        if (isolate)
+            isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Internal error in 'Native_Batch'").ToLocalChecked()));
+    }
+}
+
+void Natives::Attach_Hooks(const std::string& name, Native_Hook_Chain* chain) {
+    auto it = binding_ids_.find(name);
+
+    if (it != binding_ids_.end())
+        bindings_storage_[it->second]->hooks = chain;
+}
+
+void Natives::Detach_Hooks() {
+    for (auto& binding : bindings_storage_)
+        binding->hooks = nullptr;
+}
+
+bool Natives::Is_In_Fast_Call() {
+    return tl_in_fast_call;
 }
 
 void Natives::Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
@@ -151,8 +373,8 @@ void Natives::Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
         if (!data || !data->native_func)
             throw AMX_Exception("Native function pointer is null.");
 
-        if (has_any_hooks.load(std::memory_order_relaxed)) {
-            if (!Native_Hooks::Instance().Dispatch(isolate, data->native_name, info))
+        if (data->hooks) {
+            if (!Native_Hooks::Instance().Dispatch(isolate, *data->hooks, info))
                 return;
         }
 
@@ -163,34 +385,65 @@ void Natives::Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
             cell params[1] = { 0 };
             cell retval = data->native_func(amx_fake, params);
 
-            info.GetReturnValue().Set(v8::Integer::New(isolate, retval));
+            Set_Return(info, isolate, data, retval);
 
             return;
         }
 
         AMX* amx_fake = tl_sandbox.Get();
+        Amx_Arena arena(amx_fake);
         
         if (argc <= static_cast<int>(Constants::STACK_ARGS_THRESHOLD)) {
-            Type_Converter::Conversion_Result conversions[Constants::STACK_ARGS_THRESHOLD];
             Type_Converter::Ref_Update_Data updates_stack[Constants::STACK_ARGS_THRESHOLD];
+            Type_Converter::Typed_Output outputs_stack[Constants::STACK_ARGS_THRESHOLD];
             size_t updates_count = 0;
+            size_t outputs_count = 0;
+            size_t slot = 0;
+            int i = 0;
             cell params_stack[Constants::STACK_BUFFER_SIZE] {};
             
-            params_stack[0] = argc * sizeof(cell);
-            
-            for (int i = 0; i < argc; i++) {
-                conversions[i] = Type_Converter::To_Cell(isolate, context, info[i], amx_fake);
-                params_stack[i + 1] = conversions[i].value;
+            for (; i < argc && slot < Constants::STACK_ARGS_THRESHOLD; i++) {
+                char type = Get_Param_Type(data, static_cast<int>(slot));
+
+                if ((type == Constants::SIGNATURE_TYPE_INT_REF || type == Constants::SIGNATURE_TYPE_FLOAT_REF) && (info[i]->IsInt32Array() || info[i]->IsFloat32Array())) {
+                    v8::Local<v8::TypedArray> array = info[i].As<v8::TypedArray>();
+                    size_t run = Get_Ref_Run(data->signature->params + slot);
+
+                    // A typed array fills the whole run of reference parameters, so a short one would leave the rest pointing at address 0.
+                    if (array->Length() < run)
+                        return Throw_Range_Error(isolate, "Native '" + data->native_name + "': typed array has " + std::to_string(array->Length()) + " element(s) but " + std::to_string(run) + " reference parameter(s) follow.");
+
+                    if (slot + run > Constants::STACK_ARGS_THRESHOLD)
+                        return Throw_Range_Error(isolate, "Native '" + data->native_name + "': typed array outputs exceed the " + std::to_string(Constants::STACK_ARGS_THRESHOLD) + " parameter limit.");
+
+                    size_t bound = Type_Converter::Bind_Typed_Outputs(array, data->signature->params + slot, run, amx_fake, params_stack + slot + 1, outputs_stack + outputs_count);
+
+                    if (bound > 0) {
+                        slot += bound;
+                        outputs_count += bound;
+
+                        continue;
+                    }
+                }
+
+                Type_Converter::Conversion_Result conversion = Type_Converter::To_Cell(isolate, context, info[i], amx_fake, type);
+                params_stack[++slot] = conversion.value;
                 
-                if (conversions[i].Has_Update())
-                    updates_stack[updates_count++] = conversions[i].update_data;
+                if (conversion.Has_Update())
+                    updates_stack[updates_count++] = conversion.update_data;
             }
+
+            if (i < argc)
+                return Throw_Range_Error(isolate, "Native '" + data->native_name + "': too many arguments after typed array outputs (limit is " + std::to_string(Constants::STACK_ARGS_THRESHOLD) + " parameters).");
+
+            params_stack[0] = static_cast<cell>(slot * sizeof(cell));
             
             cell retval = data->native_func(amx_fake, params_stack);
             
             Type_Converter::Apply_Updates(isolate, context, updates_stack, updates_count);
+            Type_Converter::Apply_Typed_Outputs(outputs_stack, outputs_count);
             
-            info.GetReturnValue().Set(v8::Integer::New(isolate, retval));
+            Set_Return(info, isolate, data, retval);
 
             return;
         }
@@ -206,7 +459,7 @@ void Natives::Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
         params_vec.push_back(argc * sizeof(cell));
 
         for (int i = 0; i < argc; i++) {
-            conversions.push_back(Type_Converter::To_Cell(isolate, context, info[i], amx_fake));
+            conversions.push_back(Type_Converter::To_Cell(isolate, context, info[i], amx_fake, Get_Param_Type(data, i)));
             params_vec.push_back(conversions.back().value);
             
             if (conversions.back().Has_Update())
@@ -217,7 +470,7 @@ void Natives::Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
 
         Type_Converter::Apply_Updates(isolate, context, updates_vector.data(), updates_vector.size());
 
-        info.GetReturnValue().Set(v8::Integer::New(isolate, retval));
+        Set_Return(info, isolate, data, retval);
     }
     catch (const Plugin_Exception& e) {
         Logger::Log(Log_Level::ERROR_s, "'%s'.", e.what());
@@ -36,24 +36,39 @@
 #include <cstdint>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 //
 #include "sdk/amx/amx_defs.h" 
 //
 #include "node_inclusion.hpp"
+#include "native_signatures.hpp"
+
+struct Native_Hook_Chain;
 
 struct Native_Binding_Data {
     AMX_NATIVE native_func = nullptr;
+    uint32_t id = 0;
     uint32_t native_hash = 0;
     std::string native_name;
+    const Native_Signature* signature = nullptr;
+    size_t param_count = 0;
+    Native_Hook_Chain* hooks = nullptr;
 };
 
 class Natives {
     public:
         static void Generate_Binding(v8::Isolate* isolate, v8::Local<v8::Object> target, const std::string& name, uint32_t hash);
-        static void Set_Has_Hooks(bool has_hooks);
+        static void Attach_Hooks(const std::string& name, Native_Hook_Chain* chain);
+        static void Detach_Hooks();
+        static bool Is_In_Fast_Call();
         static void Handler(const v8::FunctionCallbackInfo<v8::Value>& info);
+        static void Generate_Batch_Bindings(v8::Isolate* isolate, v8::Local<v8::Context> context);
         static void Clear_Bindings();
 
     private:
+        static void Resolve_Handler(const v8::FunctionCallbackInfo<v8::Value>& info);
+        static void Batch_Handler(const v8::FunctionCallbackInfo<v8::Value>& info);
+
         static std::vector<std::unique_ptr<Native_Binding_Data>> bindings_storage_;
+        static std::unordered_map<std::string, uint32_t> binding_ids_;
 };
\ No newline at end of file
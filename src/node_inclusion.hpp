@@ -38,6 +38,7 @@
 
 #include "node.h"
 #include "v8.h"
+#include "v8-fast-api-calls.h"
 #include "uv.h"
 
 #pragma warning(pop)
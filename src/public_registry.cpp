@@ -0,0 +1,109 @@
+/* ============================================================================ *
+ * Kainure - Node.js Framework for SA-MP (San Andreas Multiplayer)              *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * Kainure embeds Node.js runtime into SA-MP servers, enabling developers       *
+ * to write gamemodes using modern JavaScript/TypeScript with full access       *
+ * to the Node.js ecosystem, async/await, npm packages, and native SA-MP        *
+ * functions through automatic bindings.                                        *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/kainure                          *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the Apache License, Version 2.0 (the "License");              *
+ * you may not use this file except in compliance with the License.             *
+ * You may obtain a copy of the License at:                                     *
+ *                                                                              *
+ *     http://www.apache.org/licenses/LICENSE-2.0                               *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#include "public_registry.hpp"
+#include "constants.hpp"
+
+Public_Registry& Public_Registry::Instance() {
+    static Public_Registry instance;
+
+    return instance;
+}
+
+Public_Entry& Public_Registry::Register(const std::string& name, const std::string& signature, uint32_t listener_count) {
+    auto [it, inserted] = entries_.try_emplace(name);
+    Public_Entry& entry = it->second;
+
+    if (inserted) {
+        entry.id = next_id_++;
+        entry.name = name;
+    }
+
+    if (inserted || entry.signature != signature)
+        Compile_Signature(entry, signature);
+
+    entry.listener_count = listener_count;
+    entry.listeners_dirty = true;
+
+    return entry;
+}
+
+Public_Entry* Public_Registry::Find(const std::string& name) {
+    auto it = entries_.find(name);
+
+    return it != entries_.end() ? &it->second : nullptr;
+}
+
+const Public_Entry* Public_Registry::Find(const std::string& name) const {
+    auto it = entries_.find(name);
+
+    return it != entries_.end() ? &it->second : nullptr;
+}
+
+bool Public_Registry::Has_Listeners(const std::string& name) const {
+    const Public_Entry* entry = Find(name);
+
+    return entry && entry->listener_count > 0;
+}
+
+void Public_Registry::Compile_Signature(Public_Entry& entry, const std::string& signature) {
+    entry.signature = signature;
+    entry.params.clear();
+    entry.params.reserve(signature.length());
+
+    for (char type_char : signature) {
+        switch (type_char) {
+            case Constants::SIGNATURE_TYPE_FLOAT:
+                entry.params.push_back(Param_Type::Float);
+
+                break;
+            case Constants::SIGNATURE_TYPE_STRING:
+                entry.params.push_back(Param_Type::String);
+
+                break;
+            case Constants::SIGNATURE_TYPE_BOOL:
+                entry.params.push_back(Param_Type::Bool);
+
+                break;
+            default: // SIGNATURE_TYPE_INTEGER ;)
+                entry.params.push_back(Param_Type::Integer);
+
+                break;
+        }
+    }
+}
+
+void Public_Registry::Clear() {
+    entries_.clear();
+    next_id_ = 0;
+}
\ No newline at end of file
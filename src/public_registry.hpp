@@ -0,0 +1,89 @@
+/* ============================================================================ *
+ * Kainure - Node.js Framework for SA-MP (San Andreas Multiplayer)              *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * Kainure embeds Node.js runtime into SA-MP servers, enabling developers       *
+ * to write gamemodes using modern JavaScript/TypeScript with full access       *
+ * to the Node.js ecosystem, async/await, npm packages, and native SA-MP        *
+ * functions through automatic bindings.                                        *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/kainure                          *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the Apache License, Version 2.0 (the "License");              *
+ * you may not use this file except in compliance with the License.             *
+ * You may obtain a copy of the License at:                                     *
+ *                                                                              *
+ *     http://www.apache.org/licenses/LICENSE-2.0                               *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+//
+#include "node_inclusion.hpp"
+
+enum class Param_Type : uint8_t {
+    Integer,
+    Float,
+    String,
+    Bool
+};
+
+struct Public_Entry {
+    uint32_t id = 0;
+    std::string name;
+    v8::Eternal<v8::String> v8_name;
+    std::string signature;
+    std::vector<Param_Type> params;
+    uint32_t listener_count = 0;
+    std::vector<v8::Global<v8::Function>> listeners;
+    bool listeners_dirty = true;
+
+    v8::Local<v8::String> Get_V8_Name(v8::Isolate* isolate) {
+        if (v8_name.IsEmpty())
+            v8_name.Set(isolate, v8::String::NewFromUtf8(isolate, name.c_str(), v8::NewStringType::kInternalized).ToLocalChecked());
+
+        return v8_name.Get(isolate);
+    }
+};
+
+class Public_Registry {
+    public:
+        static Public_Registry& Instance();
+
+        Public_Entry& Register(const std::string& name, const std::string& signature, uint32_t listener_count);
+        Public_Entry* Find(const std::string& name);
+        const Public_Entry* Find(const std::string& name) const;
+        bool Has_Listeners(const std::string& name) const;
+        void Clear();
+
+    private:
+        static void Compile_Signature(Public_Entry& entry, const std::string& signature);
+
+        Public_Registry() = default;
+        ~Public_Registry() = default;
+
+        Public_Registry(const Public_Registry&) = delete;
+        Public_Registry& operator=(const Public_Registry&) = delete;
+
+        std::unordered_map<std::string, Public_Entry> entries_;
+        uint32_t next_id_ = 0;
+};
\ No newline at end of file
@@ -31,22 +31,134 @@
  * ============================================================================ */
 
 #include <vector>
+#include <string>
+#include <string_view>
+#include <cstring>
+#include <algorithm>
 //
 #include "sdk/amx/amx_api.hpp"
 #include "sdk/amx/amx_defs.h"
 #include "sdk/amx/amx_manager.hpp"
 #include "sdk/hooks/interceptor_manager.hpp"
 #include "sdk/events/public_dispatcher.hpp"
+#include "sdk/core/platform.hpp"
 //
+#include "amx_arena.hpp"
 #include "encoding_converter.hpp"
 #include "publics.hpp"
 #include "event_dispatcher.hpp"
+#include "public_registry.hpp"
+#include "natives.hpp"
 #include "runtime_manager.hpp"
 #include "constants.hpp"
 #include "logger.hpp"
 #include "type_converter.hpp"
 #include "exceptions.hpp"
 
+namespace {
+    static thread_local std::string tl_string_scratch;
+    static thread_local std::string tl_convert_scratch;
+
+    std::string_view Read_String_Param(AMX* amx, cell param_value) {
+        cell* phys_addr = nullptr;
+
+        if (Samp_SDK::amx::Get_Addr(amx, param_value, &phys_addr) != static_cast<int>(Amx_Error::None) || phys_addr == nullptr)
+            return {};
+
+        int len = 0;
+
+        if (Samp_SDK::amx::STR_Len(phys_addr, &len) != static_cast<int>(Amx_Error::None) || len < 0)
+            return {};
+
+        Encoding_Converter& converter = Encoding_Converter::Instance();
+
+        tl_string_scratch.resize(static_cast<size_t>(len) + 1);
+        Samp_SDK::amx::Get_String(tl_string_scratch.data(), phys_addr, len + 1);
+        tl_string_scratch.resize(strnlen(tl_string_scratch.data(), static_cast<size_t>(len)));
+
+        tl_convert_scratch.resize(converter.Max_UTF8_Length(tl_string_scratch.length()));
+        size_t utf8_len = converter.Target_To_UTF8(tl_string_scratch, tl_convert_scratch.data(), tl_convert_scratch.size());
+
+        return std::string_view(tl_convert_scratch.data(), utf8_len);
+    }
+
+    v8::Local<v8::Value> Marshal_String(v8::Isolate* isolate, std::string_view text) {
+        if (text.empty())
+            return v8::String::Empty(isolate);
+
+        return v8::String::NewFromUtf8(isolate, text.data(), v8::NewStringType::kNormal, static_cast<int>(text.size())).ToLocalChecked();
+    }
+
+    v8::Local<v8::Value> Marshal_Value(v8::Isolate* isolate, cell value, Param_Type type) {
+        switch (type) {
+            case Param_Type::Float:
+                return v8::Number::New(isolate, Samp_SDK::amx::AMX_CTOF(value));
+            case Param_Type::Bool:
+                return v8::Boolean::New(isolate, value != 0);
+            default:
+                return v8::Integer::New(isolate, value);
+        }
+    }
+
+    SAMP_SDK_FORCE_INLINE v8::Local<v8::Value> Marshal_Param(v8::Isolate* isolate, AMX* amx, int index, Param_Type type) {
+        cell param_value;
+
+        if (!Samp_SDK::Detail::Public_Param_Reader::Get_Stack_Cell(amx, index, param_value))
+            return v8::Undefined(isolate);
+
+        if (type == Param_Type::String)
+            return Marshal_String(isolate, Read_String_Param(amx, param_value));
+
+        return Marshal_Value(isolate, param_value, type);
+    }
+}
+
+std::vector<Publics::Pending_Public> Publics::pending_;
+
+void Publics::Queue_Pending(const std::string& name, AMX* amx, const Public_Entry& entry) {
+    Pending_Public& call = pending_.emplace_back();
+    int param_count = amx ? std::max(amx->paramcount, 0) : 0;
+
+    call.name = name;
+    call.args.resize(static_cast<size_t>(param_count));
+
+    for (int i = 0; i < param_count; i++) {
+        Pending_Arg& arg = call.args[i];
+        arg.type = (static_cast<size_t>(i) < entry.params.size()) ? entry.params[i] : Param_Type::Integer;
+
+        if (!Samp_SDK::Detail::Public_Param_Reader::Get_Stack_Cell(amx, i, arg.value))
+            continue;
+
+        // Strings are copied now, since the AMX heap they live on is reused as soon as the native returns.
+        if (arg.type == Param_Type::String)
+            arg.text = Read_String_Param(amx, arg.value);
+    }
+}
+
+void Publics::Dispatch_Pending(v8::Isolate* isolate, v8::Local<v8::Context> context) {
+    if (pending_.empty())
+        return;
+
+    std::vector<Pending_Public> pending;
+    pending.swap(pending_);
+
+    for (const Pending_Public& call : pending) {
+        Public_Entry* entry = Public_Registry::Instance().Find(call.name);
+
+        if (!entry || entry->listener_count == 0)
+            continue;
+
+        v8::HandleScope handle_scope(isolate);
+        std::vector<v8::Local<v8::Value>> js_args;
+        js_args.reserve(call.args.size());
+
+        for (const Pending_Arg& arg : call.args)
+            js_args.push_back(arg.type == Param_Type::String ? Marshal_String(isolate, arg.text) : Marshal_Value(isolate, arg.value, arg.type));
+
+        Event_Dispatcher::Instance().Dispatch_Event(isolate, context, *entry, js_args.data(), js_args.size());
+    }
+}
+
 bool Publics::Handler(const std::string& name, AMX* amx, cell& result) {
     try {
         if (name == Constants::EVENT_GAMEMODE_INIT)
@@ -57,9 +169,15 @@ bool Publics::Handler(const std::string& name, AMX* amx, cell& result) {
         if (!runtime.Is_Initialized())
             return true;
 
-        if (!Event_Dispatcher::Instance().Has_Listeners(name))
+        Public_Entry* entry = Public_Registry::Instance().Find(name);
+
+        if (!entry || entry->listener_count == 0)
             return true;
 
+        // A fast native call cannot re-enter JavaScript (e.g. a plugin hooking a getter), so the public is kept for the next safe point.
+        if (Natives::Is_In_Fast_Call())
+            return (Queue_Pending(name, amx, *entry), true);
+
         v8::Isolate* isolate = runtime.Get_Isolate();
 
         if (!isolate)
@@ -75,72 +193,29 @@ bool Publics::Handler(const std::string& name, AMX* amx, cell& result) {
 
         v8::Context::Scope context_scope(context);
 
+        Dispatch_Pending(isolate, context);
+
         if (!amx)
             throw AMX_Exception("AMX pointer is null in 'Publics::Handler'.");
 
-        std::string signature = Event_Dispatcher::Instance().Get_Signature(name);
-        size_t sig_len = signature.length();
-
-        int param_count = amx->paramcount;
-        std::vector<v8::Local<v8::Value>> js_args;
-        js_args.reserve(param_count);
-
-        for (int i = 0; i < param_count; i++) {
-            cell param_value;
+        int param_count = std::max(amx->paramcount, 0);
+        size_t compiled_count = entry->params.size();
 
-            if (!Samp_SDK::Detail::Public_Param_Reader::Get_Stack_Cell(amx, i, param_value)) {
-                js_args.push_back(v8::Undefined(isolate));
+        v8::Local<v8::Value> js_args_stack[Constants::STACK_ARGS_THRESHOLD];
+        std::vector<v8::Local<v8::Value>> js_args_heap;
+        v8::Local<v8::Value>* js_args = js_args_stack;
 
-                continue;
-            }
-
-            char type_char = (i < static_cast<int>(sig_len)) ? signature[i] : Constants::SIGNATURE_TYPE_INTEGER;
-
-            switch (type_char) {
-                case Constants::SIGNATURE_TYPE_FLOAT: {
-                    float f_val = Samp_SDK::amx::AMX_CTOF(param_value);
-                    js_args.push_back(v8::Number::New(isolate, f_val));
-
-                    break;
-                }
-                case Constants::SIGNATURE_TYPE_STRING: {
-                    cell* phys_addr = nullptr;
-
-                    if (Samp_SDK::amx::Get_Addr(amx, param_value, &phys_addr) == static_cast<int>(Amx_Error::None) && phys_addr != nullptr) {
-                        int len = 0;
-
-                        if (Samp_SDK::amx::STR_Len(phys_addr, &len) == static_cast<int>(Amx_Error::None) && len >= 0) {
-                            std::string target_str(len, '\0');
-                            Samp_SDK::amx::Get_String(&target_str[0], phys_addr, len + 1);
-
-                            if (!target_str.empty() && target_str.back() == '\0')
-                                target_str.pop_back();
-
-                            std::string utf8_str = Encoding_Converter::Instance().Target_To_UTF8(target_str);
-
-                            js_args.push_back(v8::String::NewFromUtf8(isolate, utf8_str.c_str(),
-                                v8::NewStringType::kNormal).ToLocalChecked());
-                        }
-                        else
-                            js_args.push_back(v8::String::Empty(isolate));
-                    }
-                    else
-                        js_args.push_back(v8::String::Empty(isolate));
-
-                    break;
-                }
-                case Constants::SIGNATURE_TYPE_BOOL:
-                    js_args.push_back(v8::Boolean::New(isolate, param_value != 0));
-
-                    break;
-                default: // SIGNATURE_TYPE_INTEGER ;)
-                    js_args.push_back(v8::Integer::New(isolate, param_value));
+        if (param_count > static_cast<int>(Constants::STACK_ARGS_THRESHOLD)) {
+            js_args_heap.resize(param_count);
+            js_args = js_args_heap.data();
+        }
 
-                    break;
-            }
+        for (int i = 0; i < param_count; i++) {
+            Param_Type type = (static_cast<size_t>(i) < compiled_count) ? entry->params[i] : Param_Type::Integer;
+            js_args[i] = Marshal_Param(isolate, amx, i, type);
         }
 
-        cell return_value = Event_Dispatcher::Instance().Dispatch_Event(name, amx, js_args);
+        cell return_value = Event_Dispatcher::Instance().Dispatch_Event(isolate, context, *entry, js_args, static_cast<size_t>(param_count));
         result = return_value;
 
         if (name == Constants::EVENT_PLAYER_COMMAND) {
@@ -171,87 +246,118 @@ bool Publics::Has_Handler(const std::string& name) {
     }
 }
 
-void Publics::Call_Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
-    v8::Isolate* isolate = info.GetIsolate();
+std::unordered_map<std::string, Publics::Public_Handle> Publics::handles_;
+uint32_t Publics::handles_generation_ = 1;
 
-    try {
-        if (!isolate)
-            throw V8_Exception("Isolate is null in 'Call_Handler'.");
+Publics::Public_Handle& Publics::Resolve_Handle(const std::string& name) {
+    Public_Handle& handle = handles_[name];
 
-        v8::HandleScope handle_scope(isolate);
-        v8::Local<v8::Context> context = isolate->GetCurrentContext();
+    if (handle.generation == handles_generation_)
+        return handle;
 
-        if (info.Length() < 1 || !info[0]->IsString())
-            throw AMX_Exception("Call_Public: First argument must be the function name.");
+    handle.name = name;
+    handle.index = -1;
+    handle.amx = Samp_SDK::Amx_Manager::Instance().Find_Public(name.c_str(), handle.index);
 
-        v8::String::Utf8Value str_name(isolate, info[0]);
-        if (!*str_name)
-            throw AMX_Exception("Call_Public: Failed to convert function name to string.");
+    if (!handle.amx) {
+        handle.amx = Samp_SDK::Amx_Manager::Instance().Get_Primary_Amx();
 
-        std::string public_name = *str_name;
+        if (handle.amx && Samp_SDK::amx::Find_Public(handle.amx, name.c_str(), &handle.index) != 0)
+            handle.amx = nullptr;
+    }
 
-        int public_index = -1;
-        AMX* target_amx = Samp_SDK::Amx_Manager::Instance().Find_Public(public_name.c_str(), public_index);
+    handle.generation = handles_generation_;
 
-        if (!target_amx) {
-            target_amx = Samp_SDK::Amx_Manager::Instance().Get_Primary_Amx();
+    return handle;
+}
 
-            if (target_amx) {
-                int find_result = Samp_SDK::amx::Find_Public(target_amx, public_name.c_str(), &public_index);
+void Publics::Invalidate_Handles() {
+    ++handles_generation_;
+}
 
-                if (find_result != 0)
-                    target_amx = nullptr;
-            }
-        }
+void Publics::Clear_Handles() {
+    handles_.clear();
+    pending_.clear();
+    ++handles_generation_;
+}
+
+void Publics::Invoke(const v8::FunctionCallbackInfo<v8::Value>& info, int first_arg, Public_Handle& handle) {
+    v8::Isolate* isolate = info.GetIsolate();
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
 
-        if (!target_amx) {
-            std::string err_msg = "The public '" + public_name + "' was not found.";
-            isolate->ThrowException(v8::Exception::ReferenceError(v8::String::NewFromUtf8(isolate, err_msg.c_str(), v8::NewStringType::kNormal).ToLocalChecked()));
+    if (handle.generation != handles_generation_)
+        Resolve_Handle(handle.name);
 
-            return;
-        }
+    if (!handle.amx) {
+        std::string err_msg = "The public '" + handle.name + "' was not found.";
+        isolate->ThrowException(v8::Exception::ReferenceError(v8::String::NewFromUtf8(isolate, err_msg.c_str(), v8::NewStringType::kNormal).ToLocalChecked()));
 
-        int args_count = info.Length() - 1;
-        
-        std::vector<Type_Converter::Conversion_Result> converted_args;
-        converted_args.reserve(args_count);
-        
-        std::vector<Type_Converter::Ref_Update_Data> updates;
-        updates.reserve(args_count);
+        return;
+    }
 
-        for (int i = 0; i < args_count; i++) {
-            converted_args.push_back(Type_Converter::To_Cell(isolate, context, info[i + 1], target_amx));
+    AMX* target_amx = handle.amx;
+    int public_index = handle.index;
+    int args_count = info.Length() - first_arg;
+    Amx_Arena arena(target_amx);
+    
+    std::vector<Type_Converter::Conversion_Result> converted_args;
+    converted_args.reserve(args_count);
+    
+    std::vector<Type_Converter::Ref_Update_Data> updates;
+    updates.reserve(args_count);
+
+    for (int i = 0; i < args_count; i++) {
+        converted_args.push_back(Type_Converter::To_Cell(isolate, context, info[i + first_arg], target_amx));
+
+        if (converted_args.back().Has_Update())
+            updates.push_back(converted_args.back().update_data);
+    }
 
-            if (converted_args.back().Has_Update())
-                updates.push_back(converted_args.back().update_data);
-        }
+    cell hea_before = target_amx->hea;
+    cell stk_before = target_amx->stk;
 
-        cell hea_before = target_amx->hea;
-        cell stk_before = target_amx->stk;
+    for (int i = args_count - 1; i >= 0; i--) {
+        int push_result = Samp_SDK::amx::Push(target_amx, converted_args[i].value);
 
-        for (int i = args_count - 1; i >= 0; i--) {
-            int push_result = Samp_SDK::amx::Push(target_amx, converted_args[i].value);
+        if (push_result != static_cast<int>(Amx_Error::None))
+            throw AMX_Exception("Failed to push argument " + std::to_string(i) + " to AMX stack.");
+    }
 
-            if (push_result != static_cast<int>(Amx_Error::None))
-                throw AMX_Exception("Failed to push argument " + std::to_string(i) + " to AMX stack.");
-        }
+    cell retval = 0;
+    int exec_error = Samp_SDK::amx::Exec(target_amx, &retval, public_index);
 
-        cell retval = 0;
-        int exec_error = Samp_SDK::amx::Exec(target_amx, &retval, public_index);
+    target_amx->hea = hea_before;
+    target_amx->stk = stk_before;
 
-        target_amx->hea = hea_before;
-        target_amx->stk = stk_before;
+    Type_Converter::Apply_Updates(isolate, context, updates.data(), updates.size());
 
-        Type_Converter::Apply_Updates(isolate, context, updates.data(), updates.size());
+    if (exec_error != static_cast<int>(Amx_Error::None) && exec_error != static_cast<int>(Amx_Error::Sleep)) {
+        bool is_expected_ghost_error = (public_index == PLUGIN_EXEC_GHOST_PUBLIC && exec_error == static_cast<int>(Amx_Error::Index));
 
-        if (exec_error != static_cast<int>(Amx_Error::None) && exec_error != static_cast<int>(Amx_Error::Sleep)) {
-            bool is_expected_ghost_error = (public_index == PLUGIN_EXEC_GHOST_PUBLIC && exec_error == static_cast<int>(Amx_Error::Index));
+        if (!is_expected_ghost_error)
+            Logger::Log(Log_Level::ERROR_s, "Error executing public '%s': Code '%d'.", handle.name.c_str(), exec_error);
+    }
 
-            if (!is_expected_ghost_error)
-                Logger::Log(Log_Level::ERROR_s, "Error executing public '%s': Code '%d'.", public_name.c_str(), exec_error);
-        }
+    info.GetReturnValue().Set(v8::Integer::New(isolate, retval));
+}
 
-        info.GetReturnValue().Set(v8::Integer::New(isolate, retval));
+void Publics::Call_Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+
+    try {
+        if (!isolate)
+            throw V8_Exception("Isolate is null in 'Call_Handler'.");
+
+        v8::HandleScope handle_scope(isolate);
+
+        if (info.Length() < 1 || !info[0]->IsString())
+            throw AMX_Exception("Call_Public: First argument must be the function name.");
+
+        v8::String::Utf8Value str_name(isolate, info[0]);
+        if (!*str_name)
+            throw AMX_Exception("Call_Public: Failed to convert function name to string.");
+
+        Invoke(info, 1, Resolve_Handle(*str_name));
     }
     catch (const Plugin_Exception& e) {
         Logger::Log(Log_Level::ERROR_s, "'%s'.", e.what());
@@ -265,4 +371,44 @@ void Publics::Call_Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
         if (isolate)
             isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Internal error in 'Call_Public'").ToLocalChecked()));
     }
+}
+
+void Publics::Bound_Call_Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+    Public_Handle* handle = static_cast<Public_Handle*>(info.Data().As<v8::External>()->Value());
+
+    try {
+        v8::HandleScope handle_scope(isolate);
+
+        Invoke(info, 0, *handle);
+    }
+    catch (const Plugin_Exception& e) {
+        Logger::Log(Log_Level::ERROR_s, "'%s'.", e.what());
+
+        isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, e.what()).ToLocalChecked()));
+    }
+    catch (const std::exception& e) {
+        Logger::Log(Log_Level::ERROR_s, "Unexpected exception in 'Bound_Call_Handler': '%s'.", e.what());
+
+        isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Internal error in 'Call_Public'").ToLocalChecked()));
+    }
+}
+
+void Publics::Bind_Handler(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+    if (info.Length() < 1 || !info[0]->IsString())
+        return (void)isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Call_Public: Public name must be a string.").ToLocalChecked()));
+
+    v8::String::Utf8Value str_name(isolate, info[0]);
+    Public_Handle& handle = Resolve_Handle(*str_name);
+
+    v8::Local<v8::Function> fn;
+
+    if (v8::Function::New(context, Bound_Call_Handler, v8::External::New(isolate, &handle)).ToLocal(&fn)) {
+        fn->SetName(info[0].As<v8::String>());
+        info.GetReturnValue().Set(fn);
+    }
 }
\ No newline at end of file
@@ -33,14 +33,50 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
 //
 #include "sdk/amx/amx_defs.h"
 //
 #include "node_inclusion.hpp"
+#include "public_registry.hpp"
 
 class Publics {
     public:
         static bool Handler(const std::string& name, AMX* amx, cell& result);
         static bool Has_Handler(const std::string& name);
         static void Call_Handler(const v8::FunctionCallbackInfo<v8::Value>& info);
+        static void Bind_Handler(const v8::FunctionCallbackInfo<v8::Value>& info);
+        static void Invalidate_Handles();
+        static void Clear_Handles();
+        static void Dispatch_Pending(v8::Isolate* isolate, v8::Local<v8::Context> context);
+
+    private:
+        struct Pending_Arg {
+            Param_Type type = Param_Type::Integer;
+            cell value = 0;
+            std::string text;
+        };
+
+        struct Pending_Public {
+            std::string name;
+            std::vector<Pending_Arg> args;
+        };
+
+        struct Public_Handle {
+            std::string name;
+            AMX* amx = nullptr;
+            int index = -1;
+            uint32_t generation = 0;
+        };
+
+        static Public_Handle& Resolve_Handle(const std::string& name);
+        static void Invoke(const v8::FunctionCallbackInfo<v8::Value>& info, int first_arg, Public_Handle& handle);
+        static void Bound_Call_Handler(const v8::FunctionCallbackInfo<v8::Value>& info);
+        static void Queue_Pending(const std::string& name, AMX* amx, const Public_Entry& entry);
+
+        static std::unordered_map<std::string, Public_Handle> handles_;
+        static uint32_t handles_generation_;
+        static std::vector<Pending_Public> pending_;
 };
\ No newline at end of file
@@ -32,8 +32,9 @@
 
 #include <vector>
 #include <string>
-#include <sstream>
+#include <string_view>
 #include <algorithm>
+#include <cstring>
 #include <new>
 //
 #include "sdk/utils/logger.hpp"
@@ -47,6 +48,81 @@
 #include "logger.hpp"
 #include "exceptions.hpp"
 #include "code_preprocessor.hpp"
+#include "startup_snapshot.hpp"
+#include "publics.hpp"
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace {
+    static thread_local std::string tl_print_buffer;
+    static thread_local std::string tl_print_converted;
+
+    class Platform_Affinity_Scope {
+        public:
+            explicit Platform_Affinity_Scope(const std::vector<int>& cpus) {
+                if (cpus.empty())
+                    return;
+
+#if defined(__linux__)
+                cpu_set_t mask;
+                CPU_ZERO(&mask);
+
+                for (int cpu : cpus) {
+                    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+                        Logger::Log(Log_Level::WARNING, "Ignoring invalid CPU '%d' in '%s'.", cpu, Constants::CONFIG_KEY_CPU_AFFINITY);
+
+                        continue;
+                    }
+
+                    CPU_SET(cpu, &mask);
+                }
+
+                if (CPU_COUNT(&mask) == 0)
+                    return;
+
+                if (pthread_getaffinity_np(pthread_self(), sizeof(previous_), &previous_) != 0) {
+                    Logger::Log(Log_Level::WARNING, "Failed to read current thread affinity. Ignoring '%s'.", Constants::CONFIG_KEY_CPU_AFFINITY);
+
+                    return;
+                }
+
+                int error = pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask);
+
+                if (error != 0) {
+                    Logger::Log(Log_Level::WARNING, "Failed to apply '%s': '%s'.", Constants::CONFIG_KEY_CPU_AFFINITY, strerror(error));
+
+                    return;
+                }
+
+                applied_ = true;
+
+                Logger::Log(Log_Level::INFO, "V8 platform worker threads pinned to '%d' CPU(s).", CPU_COUNT(&mask));
+#else
+                Logger::Log(Log_Level::WARNING, "'%s' is only supported on Linux. Ignoring.", Constants::CONFIG_KEY_CPU_AFFINITY);
+#endif
+            }
+
+            ~Platform_Affinity_Scope() {
+#if defined(__linux__)
+                if (applied_)
+                    pthread_setaffinity_np(pthread_self(), sizeof(previous_), &previous_);
+#endif
+            }
+
+            Platform_Affinity_Scope(const Platform_Affinity_Scope&) = delete;
+            Platform_Affinity_Scope& operator=(const Platform_Affinity_Scope&) = delete;
+
+        private:
+            bool applied_ = false;
+
+#if defined(__linux__)
+            cpu_set_t previous_;
+#endif
+    };
+}
 
 Runtime_Manager & Runtime_Manager::Instance() {
     static Runtime_Manager instance;
@@ -74,22 +150,39 @@ bool Runtime_Manager::Initialize() {
             throw Runtime_Exception("Failed to create V8 isolate.");
         }
 
-        if (!Initialize_Node_Environment()) {
+        bool environment_ready = Initialize_Node_Environment() && Load_Node_Environment();
+
+        // A snapshot Node accepted can still fail to restore, so it is discarded and the boot retried once from scratch.
+        if (!environment_ready && snapshot_data_) {
+            Logger::Log(Log_Level::WARNING, "Failed to start from the startup snapshot. Discarding it and retrying without it.");
+
+            Cleanup_Node_Environment();
             Cleanup_Isolate();
-            Cleanup_Platform();
+            Startup_Snapshot::Discard(process_args_, Environment_Bootstrap_Code());
+
+            if (!Initialize_Isolate()) {
+                Cleanup_Platform();
+
+                throw Runtime_Exception("Failed to create V8 isolate.");
+            }
 
-            throw Runtime_Exception("Failed to create Node.js environment.");
+            environment_ready = Initialize_Node_Environment() && Load_Node_Environment();
         }
 
-        if (!Load_Node_Environment()) {
+        if (!environment_ready) {
             Cleanup_Node_Environment();
             Cleanup_Isolate();
             Cleanup_Platform();
 
-            throw Runtime_Exception("Failed to load Node.js environment.");
+            throw Runtime_Exception("Failed to create or load Node.js environment.");
         }
 
+        if (File_Manager::Instance().Get_Config().use_startup_snapshot && !snapshot_data_)
+            Startup_Snapshot::Build(platform_.get(), process_args_, Environment_Bootstrap_Code());
+
         Setup_Console_Redirect();
+        Setup_Tick_Bindings();
+        Enable_Code_Cache();
 
         is_initialized_ = true;
 
@@ -136,17 +229,93 @@ void Runtime_Manager::Process_Tick() {
         v8::Local<v8::Context> context = context_.Get(isolate_);
         v8::Context::Scope context_scope(context);
 
+        double tick_start = platform_ ? platform_->MonotonicallyIncreasingTime() : 0.0;
+
         if (uv_loop_)
             uv_run(uv_loop_, UV_RUN_NOWAIT);
 
-        if (platform_)
+        Publics::Dispatch_Pending(isolate_, context);
+
+        if (platform_) {
             platform_->DrainTasks(isolate_);
+
+            if (tick_budget_seconds_ > 0.0 && platform_->MonotonicallyIncreasingTime() - tick_start > tick_budget_seconds_)
+                ++tick_overruns_;
+
+            if (deferred_pending_)
+                Run_Deferred(tick_start);
+        }
     }
     catch (const std::exception& e) {
         Logger::Log(Log_Level::ERROR_s, "Error in process tick: '%s'.", e.what());
     }
 }
 
+void Runtime_Manager::Run_Deferred(double tick_start) {
+    v8::Local<v8::Context> context = context_.Get(isolate_);
+
+    if (run_deferred_.IsEmpty()) {
+        v8::Local<v8::Value> run_val;
+
+        if (!context->Global()->Get(context, v8::String::NewFromUtf8(isolate_, Constants::JS_RUN_DEFERRED).ToLocalChecked()).ToLocal(&run_val) || !run_val->IsFunction()) {
+            deferred_pending_ = false;
+
+            return;
+        }
+
+        run_deferred_.Reset(isolate_, run_val.As<v8::Function>());
+    }
+
+    double remaining_ms = -1.0;
+
+    if (tick_budget_seconds_ > 0.0)
+        remaining_ms = std::max(0.0, (tick_budget_seconds_ - (platform_->MonotonicallyIncreasingTime() - tick_start)) * 1000.0);
+
+    // Closing the callback scope drains 'process.nextTick' and microtasks queued by the deferred callbacks within this tick.
+    node::CallbackScope callback_scope(node_env_, v8::Object::New(isolate_), { 0, 0 });
+    v8::TryCatch try_catch(isolate_);
+    v8::Local<v8::Value> argv[] = { v8::Number::New(isolate_, remaining_ms) };
+    v8::Local<v8::Value> result;
+
+    if (!run_deferred_.Get(isolate_)->Call(context, context->Global(), 1, argv).ToLocal(&result)) {
+        if (try_catch.HasCaught())
+            Error_Handler::Log_Exception(isolate_, try_catch);
+
+        // Cleared so a runner that keeps failing is not retried every tick; any later 'Defer()' requests it again.
+        deferred_pending_ = false;
+
+        return;
+    }
+
+    deferred_pending_ = result->IsNumber() && result.As<v8::Number>()->Value() > 0;
+}
+
+void Runtime_Manager::Setup_Tick_Bindings() {
+    tick_budget_seconds_ = File_Manager::Instance().Get_Config().tick_budget_ms / 1000.0;
+
+    if (!isolate_ || context_.IsEmpty())
+        return (void)Logger::Log(Log_Level::WARNING, "Cannot setup tick bindings: isolate or context is empty.");
+
+    v8::Locker locker(isolate_);
+    v8::Isolate::Scope isolate_scope(isolate_);
+    v8::HandleScope handle_scope(isolate_);
+    v8::Local<v8::Context> context = context_.Get(isolate_);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::Object> global = context->Global();
+
+    global->Set(context, v8::String::NewFromUtf8(isolate_, Constants::JS_REQUEST_DEFERRED).ToLocalChecked(), v8::Function::New(context, JS_Request_Deferred).ToLocalChecked()).Check();
+    global->Set(context, v8::String::NewFromUtf8(isolate_, Constants::JS_GET_TICK_OVERRUNS).ToLocalChecked(), v8::Function::New(context, JS_Get_Tick_Overruns).ToLocalChecked()).Check();
+}
+
+void Runtime_Manager::JS_Request_Deferred(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    Instance().deferred_pending_ = true;
+}
+
+void Runtime_Manager::JS_Get_Tick_Overruns(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    info.GetReturnValue().Set(Instance().tick_overruns_);
+}
+
 bool Runtime_Manager::Compile_TypeScript_If_Needed() {
     const auto& config = File_Manager::Instance().Get_Config();
 
@@ -185,7 +354,9 @@ bool Runtime_Manager::Execute_Bootstrap_Script() {
     const auto& config = File_Manager::Instance().Get_Config();
     std::string main_file = config.main_file;
 
-    if (config.use_typescript && TypeScript_Compiler::Instance().Is_TypeScript_File(main_file)) {
+    if (config.use_typescript && config.ts_mode == Constants::TS_MODE_ON_DEMAND)
+        Logger::Log(Log_Level::INFO, "Loading TypeScript on demand from: '%s'.", main_file.c_str());
+    else if (config.use_typescript && TypeScript_Compiler::Instance().Is_TypeScript_File(main_file)) {
         main_file = TypeScript_Compiler::Instance().Get_Output_Path(main_file);
         Logger::Log(Log_Level::INFO, "Loading compiled JavaScript from: '%s'.", main_file.c_str());
     }
@@ -194,6 +365,14 @@ bool Runtime_Manager::Execute_Bootstrap_Script() {
 
     std::string bootstrap_code = "require('" + std::string(Constants::FILE_FRAMEWORK) + "');\n" + "require('" + main_file + "');";
 
+    // The core modules were loaded while building the snapshot, before the registry bindings existed, so their publics are registered now.
+    if (snapshot_data_)
+        bootstrap_code = std::string(Constants::JS_KAINURE_OBJECT) + ".Sync_Publics();\n" + bootstrap_code;
+
+    // Persists the code cache of everything the gamemode loaded at startup, even if the server never exits cleanly.
+    if (config.use_code_cache)
+        bootstrap_code += "\nrequire('module').flushCompileCache?.();";
+
     v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate_, bootstrap_code.c_str()).ToLocalChecked();
     v8::ScriptOrigin origin(isolate_, v8::String::NewFromUtf8(isolate_, Constants::FILE_BOOTSTRAP).ToLocalChecked());
     v8::MaybeLocal<v8::Script> script = v8::Script::Compile(context, source, &origin);
@@ -215,6 +394,54 @@ bool Runtime_Manager::Execute_Bootstrap_Script() {
     return true;
 }
 
+void Runtime_Manager::Enable_Code_Cache() {
+    if (!File_Manager::Instance().Get_Config().use_code_cache)
+        return;
+
+    if (!isolate_ || context_.IsEmpty())
+        return (void)Logger::Log(Log_Level::WARNING, "Cannot enable code cache: isolate or context is empty.");
+
+    v8::Locker locker(isolate_);
+    v8::Isolate::Scope isolate_scope(isolate_);
+    v8::HandleScope handle_scope(isolate_);
+    v8::Local<v8::Context> context = context_.Get(isolate_);
+    v8::Context::Scope context_scope(context);
+    v8::TryCatch try_catch(isolate_);
+
+    // Node.js keeps V8 code cache per module keyed by the compiled source, which is already preprocessed, so changes to either invalidate it.
+    std::string code = R"((() => {
+        const _module = require('module');
+
+        if (typeof _module.enableCompileCache !== 'function')
+            return 'not supported by this Node.js version';
+
+        const { status, message } = _module.enableCompileCache(')" + std::string(Constants::DIR_CODE_CACHE) + R"(');
+        const { FAILED, DISABLED } = _module.constants.compileCacheStatus;
+
+        if (status === FAILED || status === DISABLED)
+            return message || 'disabled by NODE_DISABLE_COMPILE_CACHE';
+
+        process.once('exit', () => _module.flushCompileCache?.());
+
+        return '';
+    })())";
+
+    v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate_, code.c_str()).ToLocalChecked();
+    v8::ScriptOrigin origin(isolate_, v8::String::NewFromUtf8(isolate_, Constants::FILE_CODE_CACHE_SETUP).ToLocalChecked());
+    v8::Local<v8::Script> script;
+    v8::Local<v8::Value> result;
+
+    if (!v8::Script::Compile(context, source, &origin).ToLocal(&script) || !script->Run(context).ToLocal(&result))
+        return Error_Handler::Log_Exception(isolate_, try_catch);
+
+    v8::String::Utf8Value error(isolate_, result);
+
+    if (error.length() > 0)
+        return (void)Logger::Log(Log_Level::WARNING, "Code cache disabled: '%s'.", *error);
+
+    Logger::Log(Log_Level::INFO, "Code cache enabled in '%s'.", Constants::DIR_CODE_CACHE);
+}
+
 v8::Local<v8::Context> Runtime_Manager::Get_Context() const {
     if (context_.IsEmpty())
         return v8::Local<v8::Context>();
@@ -259,26 +486,70 @@ void Runtime_Manager::JS_Print(const v8::FunctionCallbackInfo<v8::Value>& info)
     if (!isolate)
         return;
 
-    std::stringstream ss;
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+    Encoding_Converter& converter = Encoding_Converter::Instance();
+
+    size_t base = tl_print_buffer.length();
 
     for (int i = 0; i < info.Length(); i++) {
-        v8::String::Utf8Value str(isolate, info[i]);
-        ss << (*str ? *str : "<invalid>");
+        v8::Local<v8::String> str;
+
+        if (info[i]->ToString(context).ToLocal(&str)) {
+            size_t offset = tl_print_buffer.length();
+            int utf8_length = str->Utf8Length(isolate);
+
+            tl_print_buffer.resize(offset + static_cast<size_t>(utf8_length));
+            str->WriteUtf8(isolate, tl_print_buffer.data() + offset, utf8_length, nullptr, v8::String::NO_NULL_TERMINATION | v8::String::REPLACE_INVALID_UTF8);
+        }
+        else
+            tl_print_buffer.append("<invalid>");
 
         if (i < info.Length() - 1)
-            ss << " ";
+            tl_print_buffer.push_back(' ');
     }
 
-    std::string message = Encoding_Converter::Instance().UTF8_To_Target(ss.str());
+    std::string_view message(tl_print_buffer.data() + base, tl_print_buffer.length() - base);
+
+    tl_print_converted.resize(converter.Max_Target_Length(message.length()) + 1);
+    size_t length = converter.UTF8_To_Target(message, tl_print_converted.data(), tl_print_converted.size() - 1);
+    tl_print_converted[length] = '\0';
+    tl_print_buffer.resize(base);
 
-    Samp_SDK::Log("%s", message.c_str());
+    Samp_SDK::Log("%s", tl_print_converted.c_str());
 }
 
 bool Runtime_Manager::Initialize_Platform() {
     Logger::Log(Log_Level::INFO, "Initializing Node.js process and V8 platform...");
 
+    const File_Manager::Config& config = File_Manager::Instance().Get_Config();
     std::vector<std::string> args = { Constants::PROCESS_NAME };
 
+    // V8 applies its heap sizing flags over the isolate's 'ResourceConstraints', and 'node::NewIsolate' exposes no create params to set them directly.
+    if (config.v8_max_old_space_mb > 0)
+        args.push_back("--max-old-space-size=" + std::to_string(config.v8_max_old_space_mb));
+
+    if (config.v8_initial_old_space_mb > 0)
+        args.push_back("--initial-old-space-size=" + std::to_string(config.v8_initial_old_space_mb));
+
+    if (config.v8_max_semi_space_mb > 0)
+        args.push_back("--max-semi-space-size=" + std::to_string(config.v8_max_semi_space_mb));
+
+    if (config.v8_expose_gc)
+        args.push_back("--expose-gc");
+
+    for (const std::string& flag : config.v8_flags) {
+        if (flag.rfind("--", 0) != 0) {
+            Logger::Log(Log_Level::WARNING, "Ignoring V8 flag '%s': flags must start with '--'.", flag.c_str());
+
+            continue;
+        }
+
+        args.push_back(flag);
+    }
+
+    for (size_t i = 1; i < args.size(); i++)
+        Logger::Log(Log_Level::INFO, "Passing V8 flag '%s'.", args[i].c_str());
+
     std::shared_ptr<node::InitializationResult> result = node::InitializeOncePerProcess(args, {
         node::ProcessInitializationFlags::kNoInitializeV8,
         node::ProcessInitializationFlags::kNoInitializeNodeV8Platform
@@ -295,11 +566,20 @@ bool Runtime_Manager::Initialize_Platform() {
 
     Logger::Log(Log_Level::INFO, "Node.js process initialized.");
 
-    platform_ = node::MultiIsolatePlatform::Create(Constants::V8_PLATFORM_THREADS);
+    process_args_ = std::move(args);
+
+    {
+        // Worker threads inherit the creating thread's affinity, so the mask only has to be held while the platform spawns them.
+        Platform_Affinity_Scope affinity(config.cpu_affinity);
+
+        platform_ = node::MultiIsolatePlatform::Create(config.platform_threads);
+    }
 
     if (!platform_)
         return (Logger::Log(Log_Level::ERROR_s, "Failed to create V8 platform."), false);
 
+    Logger::Log(Log_Level::INFO, "V8 platform created with '%d' worker thread(s).", config.platform_threads);
+
     v8::V8::InitializePlatform(platform_.get());
     v8::V8::Initialize();
 
@@ -335,7 +615,10 @@ bool Runtime_Manager::Initialize_Isolate() {
     if (!allocator_ || !uv_loop_ || !platform_)
         return (Logger::Log(Log_Level::ERROR_s, "Cannot create isolate: dependencies not initialized."), false);
 
-    isolate_ = node::NewIsolate(allocator_.get(), uv_loop_, platform_.get());
+    if (File_Manager::Instance().Get_Config().use_startup_snapshot)
+        snapshot_data_ = Startup_Snapshot::Load(process_args_, Environment_Bootstrap_Code());
+
+    isolate_ = node::NewIsolate(allocator_.get(), uv_loop_, platform_.get(), snapshot_data_.get());
 
     if (!isolate_)
         return (Logger::Log(Log_Level::ERROR_s, "'node::NewIsolate' returned nullptr."), false);
@@ -346,7 +629,12 @@ bool Runtime_Manager::Initialize_Isolate() {
     v8::Isolate::Scope isolate_scope(isolate_);
     v8::HandleScope handle_scope(isolate_);
 
-    isolate_data_ = node::CreateIsolateData(isolate_, uv_loop_, platform_.get(), allocator_.get());
+    v8::HeapStatistics heap_stats;
+    isolate_->GetHeapStatistics(&heap_stats);
+
+    Logger::Log(Log_Level::INFO, "V8 heap size limit: '%zu' MB.", heap_stats.heap_size_limit() / (1024 * 1024));
+
+    isolate_data_ = node::CreateIsolateData(isolate_, uv_loop_, platform_.get(), allocator_.get(), snapshot_data_.get());
 
     if (!isolate_data_)
         return (Logger::Log(Log_Level::ERROR_s, "'node::CreateIsolateData' returned nullptr."), false);
@@ -366,7 +654,23 @@ bool Runtime_Manager::Initialize_Node_Environment() {
     v8::Isolate::Scope isolate_scope(isolate_);
     v8::HandleScope handle_scope(isolate_);
 
-    v8::Local<v8::Context> context = node::NewContext(isolate_);
+    std::vector<std::string> args = { Constants::PROCESS_NAME };
+    std::vector<std::string> exec_args;
+
+    node::EnvironmentFlags::Flags flags = static_cast<node::EnvironmentFlags::Flags>(0);
+    v8::Local<v8::Context> context;
+
+    if (snapshot_data_) {
+        // Given an empty context, the environment adopts the main context deserialized from the snapshot.
+        node_env_ = node::CreateEnvironment(isolate_data_, v8::Local<v8::Context>(), args, exec_args, flags);
+
+        if (!node_env_)
+            return (Logger::Log(Log_Level::ERROR_s, "'node::CreateEnvironment' returned nullptr."), false);
+
+        context = node::GetMainContext(node_env_);
+    }
+    else
+        context = node::NewContext(isolate_);
 
     if (context.IsEmpty())
         return (Logger::Log(Log_Level::ERROR_s, "'node::NewContext' returned empty context."), false);
@@ -385,16 +689,16 @@ bool Runtime_Manager::Initialize_Node_Environment() {
 
         std::string transformed = Code_Preprocessor::Instance().Transform_Native_Calls(code);
 
+        if (transformed == code)
+            return info.GetReturnValue().Set(info[0]);
+
         info.GetReturnValue().Set(v8::String::NewFromUtf8(isolate, transformed.c_str()).ToLocalChecked());
     };
 
     context->Global()->Set(context, v8::String::NewFromUtf8(isolate_, Constants::JS_PREPROCESS_FUNCTION).ToLocalChecked(), v8::Function::New(context, Preprocess_Function).ToLocalChecked()).Check();
 
-    std::vector<std::string> args = { Constants::PROCESS_NAME };
-    std::vector<std::string> exec_args;
-
-    node::EnvironmentFlags::Flags flags = static_cast<node::EnvironmentFlags::Flags>(0);
-    node_env_ = node::CreateEnvironment(isolate_data_, context, args, exec_args, flags);
+    if (!node_env_)
+        node_env_ = node::CreateEnvironment(isolate_data_, context, args, exec_args, flags);
 
     if (!node_env_)
         return (Logger::Log(Log_Level::ERROR_s, "'node::CreateEnvironment' returned nullptr."), false);
@@ -421,7 +725,45 @@ bool Runtime_Manager::Load_Node_Environment() {
     v8::Context::Scope context_scope(context);
     v8::TryCatch try_catch(isolate_);
 
-    std::string bootstrap_code = R"(
+    // The snapshot already holds the module loader override and 'require' from its build, so the environment only has to start.
+    std::string bootstrap_code = snapshot_data_ ? std::string() : Environment_Bootstrap_Code();
+    v8::MaybeLocal<v8::Value> loadenv_result = node::LoadEnvironment(node_env_, bootstrap_code.c_str());
+
+    if (try_catch.HasCaught())
+        return (Error_Handler::Log_Exception(isolate_, try_catch), false);
+
+    if (loadenv_result.IsEmpty())
+        return (Logger::Log(Log_Level::ERROR_s, "LoadEnvironment returned empty value."), false);
+
+    if (snapshot_data_ && !Verify_Snapshot_Restore(context))
+        return (Logger::Log(Log_Level::WARNING, "Framework core modules are missing from 'require.cache' after restoring the startup snapshot."), false);
+
+    Logger::Log(Log_Level::INFO, "Node.js Environment loaded.");
+
+    return true;
+}
+
+bool Runtime_Manager::Verify_Snapshot_Restore(v8::Local<v8::Context> context) {
+    std::string check_code = "(() => { const r = globalThis.require; return typeof r === 'function' && [";
+
+    for (const char* module : Constants::SNAPSHOT_CORE_MODULES)
+        check_code += "'" + std::string(module) + "',";
+
+    check_code += "].every(m => !!r.cache[r.resolve(m)]); })()";
+
+    v8::TryCatch try_catch(isolate_);
+    v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate_, check_code.c_str()).ToLocalChecked();
+    v8::Local<v8::Script> script;
+    v8::Local<v8::Value> result;
+
+    if (!v8::Script::Compile(context, source).ToLocal(&script) || !script->Run(context).ToLocal(&result))
+        return false;
+
+    return result->IsTrue();
+}
+
+std::string Runtime_Manager::Environment_Bootstrap_Code() const {
+    return R"(
         delete process.stdin;
         const public_require = require('module').createRequire(process.cwd() + '/');
     
@@ -429,7 +771,8 @@ bool Runtime_Manager::Load_Node_Environment() {
         const original_compile = _module.prototype._compile;
     
         _module.prototype._compile = function(content, filename) {
-            if (filename.endsWith(')" + std::string(Constants::JS_EXTENSION) + R"('))
+            // Only unsigned natives and 'Call_Public' still need their literals rewritten, so files without either skip the round trip into C++.
+            if ((filename.endsWith(')" + std::string(Constants::JS_EXTENSION) + R"(') || filename.endsWith(')" + std::string(Constants::TS_EXTENSION) + R"(')) && (content.includes('Native.') || content.includes('Call_Public.')))
                 content = globalThis.)" + std::string(Constants::JS_PREPROCESS_FUNCTION) + R"((content);
         
             return original_compile.call(this, content, filename);
@@ -437,23 +780,20 @@ bool Runtime_Manager::Load_Node_Environment() {
     
         globalThis.require = public_require;
     )";
-
-    v8::MaybeLocal<v8::Value> loadenv_result = node::LoadEnvironment(node_env_, bootstrap_code.c_str());
-
-    if (try_catch.HasCaught())
-        return (Error_Handler::Log_Exception(isolate_, try_catch), false);
-
-    if (loadenv_result.IsEmpty())
-        return (Logger::Log(Log_Level::ERROR_s, "LoadEnvironment returned empty value."), false);
-
-    Logger::Log(Log_Level::INFO, "Node.js Environment loaded.");
-
-    return true;
 }
 
 void Runtime_Manager::Cleanup_Node_Environment() {
-    if (!node_env_)
+    if (!node_env_) {
+        // An environment that failed to come up can still leave its context and isolate data behind.
+        context_.Reset();
+
+        if (isolate_data_) {
+            node::FreeIsolateData(isolate_data_);
+            isolate_data_ = nullptr;
+        }
+
         return;
+    }
 
     try {
         if (isolate_) {
@@ -472,6 +812,9 @@ void Runtime_Manager::Cleanup_Node_Environment() {
         if (uv_loop_)
             uv_run(uv_loop_, UV_RUN_DEFAULT);
 
+        run_deferred_.Reset();
+        context_.Reset();
+
         node::FreeEnvironment(node_env_);
         node_env_ = nullptr;
 
@@ -495,6 +838,8 @@ void Runtime_Manager::Cleanup_Isolate() {
 
         isolate_->Dispose();
         isolate_ = nullptr;
+
+        snapshot_data_.reset();
     }
     catch (const std::exception& e) {
         Logger::Log(Log_Level::ERROR_s, "Error cleaning up isolate: '%s'.", e.what());
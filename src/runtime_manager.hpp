@@ -33,6 +33,9 @@
 #pragma once
 
 #include <memory>
+#include <cstdint>
+#include <string>
+#include <vector>
 //
 #include "node_inclusion.hpp"
 
@@ -77,18 +80,29 @@ class Runtime_Manager {
         bool Initialize_Isolate();
         bool Initialize_Node_Environment();
         bool Load_Node_Environment();
+        bool Verify_Snapshot_Restore(v8::Local<v8::Context> context);
+        std::string Environment_Bootstrap_Code() const;
 
         void Cleanup_Node_Environment();
         void Cleanup_Isolate();
         void Cleanup_Platform();
 
         void Setup_Console_Redirect();
+        void Enable_Code_Cache();
         static void JS_Print(const v8::FunctionCallbackInfo<v8::Value>& info);
 
         bool Compile_TypeScript_If_Needed();
 
+        void Run_Deferred(double tick_start);
+
+        void Setup_Tick_Bindings();
+        static void JS_Request_Deferred(const v8::FunctionCallbackInfo<v8::Value>& info);
+        static void JS_Get_Tick_Overruns(const v8::FunctionCallbackInfo<v8::Value>& info);
+
         std::unique_ptr<node::MultiIsolatePlatform> platform_;
         std::unique_ptr<node::ArrayBufferAllocator> allocator_;
+        std::vector<std::string> process_args_;
+        node::EmbedderSnapshotData::Pointer snapshot_data_;
 
         v8::Isolate* isolate_ = nullptr;
         node::IsolateData* isolate_data_ = nullptr;
@@ -98,4 +112,9 @@ class Runtime_Manager {
         v8::Global<v8::Context> context_;
 
         bool is_initialized_ = false;
+
+        double tick_budget_seconds_ = 0.0;
+        bool deferred_pending_ = false;
+        uint32_t tick_overruns_ = 0;
+        v8::Global<v8::Function> run_deferred_;
 };
\ No newline at end of file
@@ -0,0 +1,94 @@
+/* ============================================================================ *
+ * Kainure - Node.js Framework for SA-MP (San Andreas Multiplayer)              *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * Kainure embeds Node.js runtime into SA-MP servers, enabling developers       *
+ * to write gamemodes using modern JavaScript/TypeScript with full access       *
+ * to the Node.js ecosystem, async/await, npm packages, and native SA-MP        *
+ * functions through automatic bindings.                                        *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/kainure                          *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the Apache License, Version 2.0 (the "License");              *
+ * you may not use this file except in compliance with the License.             *
+ * You may obtain a copy of the License at:                                     *
+ *                                                                              *
+ *     http://www.apache.org/licenses/LICENSE-2.0                               *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+
+#pragma once
+
+#include <cstddef>
+//
+#include "sdk/amx/amx_defs.h"
+#include "sdk/core/platform.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define KAINURE_HAS_SSE2
+#endif
+
+class Simd {
+    public:
+        static SAMP_SDK_FORCE_INLINE size_t Find_Non_ASCII(const char* data, size_t len) {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+            size_t i = 0;
+
+#if defined(KAINURE_HAS_SSE2)
+            for (; i + 16 <= len; i += 16) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+
+                if (_mm_movemask_epi8(chunk) != 0)
+                    break;
+            }
+#endif
+
+            for (; i < len; i++) {
+                if (bytes[i] >= 0x80)
+                    return i;
+            }
+
+            return len;
+        }
+
+        static SAMP_SDK_FORCE_INLINE bool Is_ASCII(const char* data, size_t len) {
+            return Find_Non_ASCII(data, len) == len;
+        }
+
+        static SAMP_SDK_FORCE_INLINE void Widen_To_Cells(const unsigned char* src, cell* dst, size_t len) {
+            size_t i = 0;
+
+#if defined(KAINURE_HAS_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+
+            for (; i + 16 <= len; i += 16) {
+                __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                __m128i low = _mm_unpacklo_epi8(bytes, zero);
+                __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 4), _mm_unpackhi_epi16(low, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpacklo_epi16(high, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 12), _mm_unpackhi_epi16(high, zero));
+            }
+#endif
+
+            for (; i < len; i++)
+                dst[i] = static_cast<cell>(src[i]);
+        }
+};
\ No newline at end of file
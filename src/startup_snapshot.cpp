@@ -0,0 +1,277 @@
+/* ============================================================================ *
+ * Kainure - Node.js Framework for SA-MP (San Andreas Multiplayer)              *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * Kainure embeds Node.js runtime into SA-MP servers, enabling developers       *
+ * to write gamemodes using modern JavaScript/TypeScript with full access       *
+ * to the Node.js ecosystem, async/await, npm packages, and native SA-MP        *
+ * functions through automatic bindings.                                        *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/kainure                          *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the Apache License, Version 2.0 (the "License");              *
+ * you may not use this file except in compliance with the License.             *
+ * You may obtain a copy of the License at:                                     *
+ *                                                                              *
+ *     http://www.apache.org/licenses/LICENSE-2.0                               *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+//
+#include "startup_snapshot.hpp"
+#include "constants.hpp"
+#include "error_handler.hpp"
+#include "logger.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    void Hash_Field(uint64_t& hash, std::string_view data) {
+        for (unsigned char c : data) {
+            hash ^= c;
+            hash *= FNV_PRIME;
+        }
+
+        // Field separator, so moving bytes between adjacent fields changes the hash.
+        hash ^= 0xFF;
+        hash *= FNV_PRIME;
+    }
+
+    bool Read_File(const char* path, std::string& out) {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file.is_open())
+            return false;
+
+        out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+        return !file.bad();
+    }
+}
+
+std::string Startup_Snapshot::Build_Script(const std::string& bootstrap_code) {
+    std::string script = bootstrap_code;
+
+    // Only JavaScript callbacks may end up in the snapshot, so the C++ preprocessor is stood in for by a check that the core needs none.
+    // The core is loaded as ordinary CommonJS and lives in 'require.cache'; the runtime checks those entries after a restore and boots
+    // without the snapshot when any is missing.
+    script += R"(
+        globalThis.)" + std::string(Constants::JS_PREPROCESS_FUNCTION) + R"( = (content) => {
+            if (content.includes('Native.') || content.includes('Call_Public.'))
+                throw new Error('Framework core modules cannot use native call preprocessing inside the startup snapshot.');
+
+            return content;
+        };
+    )";
+
+    for (const char* module : Constants::SNAPSHOT_CORE_MODULES)
+        script += "public_require('" + std::string(module) + "');\n";
+
+    script += "delete globalThis." + std::string(Constants::JS_PREPROCESS_FUNCTION) + ";\n";
+
+    return script;
+}
+
+bool Startup_Snapshot::Compute_Fingerprint(const std::vector<std::string>& process_args, const std::string& script, std::string& fingerprint) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    Hash_Field(hash, NODE_VERSION);
+
+    for (const std::string& arg : process_args)
+        Hash_Field(hash, arg);
+
+    std::error_code ec;
+    // Module resolution caches inside the snapshot hold absolute paths from the build.
+    Hash_Field(hash, fs::current_path(ec).string());
+    Hash_Field(hash, script);
+
+    std::string source;
+
+    for (const char* module : Constants::SNAPSHOT_CORE_MODULES) {
+        if (!Read_File(module, source))
+            return (Logger::Log(Log_Level::WARNING, "Cannot read '%s' for the startup snapshot.", module), false);
+
+        Hash_Field(hash, source);
+    }
+
+    char buffer[17];
+    snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(hash));
+    fingerprint = buffer;
+
+    return true;
+}
+
+node::EmbedderSnapshotData::Pointer Startup_Snapshot::Load(const std::vector<std::string>& process_args, const std::string& bootstrap_code) {
+    if (!node::EmbedderSnapshotData::CanUseCustomSnapshotPerIsolate())
+        return (Logger::Log(Log_Level::WARNING, "This Node.js build does not support custom startup snapshots. Ignoring '%s'.", Constants::CONFIG_KEY_STARTUP_SNAPSHOT), nullptr);
+
+    std::error_code ec;
+
+    if (!fs::exists(Constants::FILE_STARTUP_SNAPSHOT, ec))
+        return (Logger::Log(Log_Level::INFO, "No startup snapshot found. One will be built during this boot."), nullptr);
+
+    std::string contents;
+
+    if (!Read_File(Constants::FILE_STARTUP_SNAPSHOT, contents))
+        return (Logger::Log(Log_Level::WARNING, "Failed to read startup snapshot '%s'.", Constants::FILE_STARTUP_SNAPSHOT), nullptr);
+
+    std::string fingerprint;
+
+    if (!Compute_Fingerprint(process_args, Build_Script(bootstrap_code), fingerprint))
+        return nullptr;
+
+    if (contents.size() <= fingerprint.size() || contents.compare(0, fingerprint.size(), fingerprint) != 0 || contents[fingerprint.size()] != '\n')
+        return (Logger::Log(Log_Level::INFO, "Startup snapshot is out of date. It will be rebuilt during this boot."), nullptr);
+
+    node::EmbedderSnapshotData::Pointer snapshot = node::EmbedderSnapshotData::FromBlob(std::string_view(contents).substr(fingerprint.size() + 1));
+
+    // A blob this Node.js rejects would be rebuilt identically, so it is remembered as failed like a build that did not finish.
+    if (!snapshot)
+        return (Mark_Failed(fingerprint), Logger::Log(Log_Level::WARNING, "Startup snapshot was rejected by Node.js. Delete '%s' to try a new one.", Constants::FILE_STARTUP_SNAPSHOT_FAILED), nullptr);
+
+    Logger::Log(Log_Level::INFO, "Using startup snapshot '%s'.", Constants::FILE_STARTUP_SNAPSHOT);
+
+    return snapshot;
+}
+
+bool Startup_Snapshot::Build(node::MultiIsolatePlatform* platform, const std::vector<std::string>& process_args, const std::string& bootstrap_code) {
+    if (!platform || !node::EmbedderSnapshotData::CanUseCustomSnapshotPerIsolate())
+        return false;
+
+    std::string script = Build_Script(bootstrap_code);
+    std::string fingerprint;
+
+    if (!Compute_Fingerprint(process_args, script, fingerprint))
+        return false;
+
+    std::string failed_fingerprint;
+
+    // A build costs a whole second environment, so one that already failed is not retried until its inputs change.
+    if (Read_File(Constants::FILE_STARTUP_SNAPSHOT_FAILED, failed_fingerprint) && failed_fingerprint == fingerprint)
+        return (Logger::Log(Log_Level::WARNING, "Skipping startup snapshot build: it failed before with the same inputs. Delete '%s' to retry.", Constants::FILE_STARTUP_SNAPSHOT_FAILED), false);
+
+    // Written up front and only removed on success, so a build that takes the whole process down is also remembered.
+    Mark_Failed(fingerprint);
+
+    if (!Create_Snapshot(platform, script, fingerprint))
+        return false;
+
+    std::error_code ec;
+    fs::remove(Constants::FILE_STARTUP_SNAPSHOT_FAILED, ec);
+
+    return true;
+}
+
+void Startup_Snapshot::Discard(const std::vector<std::string>& process_args, const std::string& bootstrap_code) {
+    std::string fingerprint;
+
+    if (Compute_Fingerprint(process_args, Build_Script(bootstrap_code), fingerprint))
+        Mark_Failed(fingerprint);
+
+    std::error_code ec;
+    fs::remove(Constants::FILE_STARTUP_SNAPSHOT, ec);
+}
+
+void Startup_Snapshot::Mark_Failed(const std::string& fingerprint) {
+    std::ofstream marker(Constants::FILE_STARTUP_SNAPSHOT_FAILED, std::ios::binary | std::ios::trunc);
+    marker << fingerprint;
+}
+
+bool Startup_Snapshot::Create_Snapshot(node::MultiIsolatePlatform* platform, const std::string& script, const std::string& fingerprint) {
+    Logger::Log(Log_Level::INFO, "Building startup snapshot...");
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::string> errors;
+    std::vector<std::string> args = { Constants::PROCESS_NAME, Constants::FILE_SNAPSHOT_BUILDER };
+    node::SnapshotConfig snapshot_config;
+    snapshot_config.builder_script_path = Constants::FILE_SNAPSHOT_BUILDER;
+
+    std::unique_ptr<node::CommonEnvironmentSetup> setup = node::CommonEnvironmentSetup::CreateForSnapshotting(platform, &errors, args, {}, snapshot_config);
+
+    if (!setup) {
+        Logger::Log(Log_Level::WARNING, "Failed to create the startup snapshot environment.");
+
+        for (const std::string& err : errors)
+            Logger::Log(Log_Level::WARNING, "   > %s", err.c_str());
+
+        return false;
+    }
+
+    {
+        v8::Isolate* isolate = setup->isolate();
+        v8::Locker locker(isolate);
+        v8::Isolate::Scope isolate_scope(isolate);
+        v8::HandleScope handle_scope(isolate);
+        v8::Context::Scope context_scope(setup->context());
+        v8::TryCatch try_catch(isolate);
+
+        if (node::LoadEnvironment(setup->env(), script.c_str()).IsEmpty() || try_catch.HasCaught()) {
+            Logger::Log(Log_Level::WARNING, "Failed to load the framework core into the startup snapshot.");
+
+            if (try_catch.HasCaught())
+                Error_Handler::Log_Exception(isolate, try_catch);
+
+            return false;
+        }
+
+        if (node::SpinEventLoop(setup->env()).FromMaybe(1) != 0)
+            return (Logger::Log(Log_Level::WARNING, "Startup snapshot builder exited with an error."), false);
+    }
+
+    node::EmbedderSnapshotData::Pointer snapshot = setup->CreateSnapshot();
+
+    if (!snapshot)
+        return (Logger::Log(Log_Level::WARNING, "Node.js failed to create the startup snapshot."), false);
+
+    std::vector<char> blob = snapshot->ToBlob();
+    std::string temp_path = std::string(Constants::FILE_STARTUP_SNAPSHOT) + ".tmp";
+
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open())
+            return (Logger::Log(Log_Level::WARNING, "Failed to open '%s' for writing.", temp_path.c_str()), false);
+
+        file << fingerprint << '\n';
+        file.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+
+        if (!file.good())
+            return (Logger::Log(Log_Level::WARNING, "Failed to write startup snapshot '%s'.", temp_path.c_str()), false);
+    }
+
+    std::error_code ec;
+    fs::rename(temp_path, Constants::FILE_STARTUP_SNAPSHOT, ec);
+
+    if (ec)
+        return (Logger::Log(Log_Level::WARNING, "Failed to replace startup snapshot: '%s'.", ec.message().c_str()), false);
+
+    double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    Logger::Log(Log_Level::INFO, "Startup snapshot built in '%.0f' ms ('%zu' KB).", elapsed_ms, blob.size() / 1024);
+
+    return true;
+}
@@ -0,0 +1,51 @@
+/* ============================================================================ *
+ * Kainure - Node.js Framework for SA-MP (San Andreas Multiplayer)              *
+ * ================================= About ==================================== *
+ *                                                                              *
+ * Kainure embeds Node.js runtime into SA-MP servers, enabling developers       *
+ * to write gamemodes using modern JavaScript/TypeScript with full access       *
+ * to the Node.js ecosystem, async/await, npm packages, and native SA-MP        *
+ * functions through automatic bindings.                                        *
+ *                                                                              *
+ * =============================== Copyright ================================== *
+ *                                                                              *
+ * Copyright (c) 2025, AlderGrounds                                             *
+ * All rights reserved.                                                         *
+ *                                                                              *
+ * Repository: https://github.com/aldergrounds/kainure                          *
+ *                                                                              *
+ * ================================ License =================================== *
+ *                                                                              *
+ * Licensed under the Apache License, Version 2.0 (the "License");              *
+ * you may not use this file except in compliance with the License.             *
+ * You may obtain a copy of the License at:                                     *
+ *                                                                              *
+ *     http://www.apache.org/licenses/LICENSE-2.0                               *
+ *                                                                              *
+ * Unless required by applicable law or agreed to in writing, software          *
+ * distributed under the License is distributed on an "AS IS" BASIS,            *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.     *
+ * See the License for the specific language governing permissions and          *
+ * limitations under the License.                                               *
+ *                                                                              *
+ * ============================================================================ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+//
+#include "node_inclusion.hpp"
+
+class Startup_Snapshot {
+    public:
+        static node::EmbedderSnapshotData::Pointer Load(const std::vector<std::string>& process_args, const std::string& bootstrap_code);
+        static bool Build(node::MultiIsolatePlatform* platform, const std::vector<std::string>& process_args, const std::string& bootstrap_code);
+        static void Discard(const std::vector<std::string>& process_args, const std::string& bootstrap_code);
+
+    private:
+        static std::string Build_Script(const std::string& bootstrap_code);
+        static void Mark_Failed(const std::string& fingerprint);
+        static bool Create_Snapshot(node::MultiIsolatePlatform* platform, const std::string& script, const std::string& fingerprint);
+        static bool Compute_Fingerprint(const std::vector<std::string>& process_args, const std::string& script, std::string& fingerprint);
+};
@@ -32,15 +32,17 @@
 
 #include <string>
 #include <cmath>
-#include <memory>
+#include <cstring>
 #include <algorithm>
 //
 #include "sdk/amx/amx_api.hpp"
 #include "sdk/core/platform.hpp"
 //
+#include "amx_arena.hpp"
 #include "encoding_converter.hpp"
 #include "type_converter.hpp"
 #include "constants.hpp"
+#include "simd.hpp"
 
 namespace {
     struct V8_String_Cache {
@@ -79,17 +81,15 @@ namespace {
     
     Type_Converter::Conversion_Result Create_Ref_Struct(v8::Local<v8::Object> parent_obj, cell value, AMX* amx, Type_Converter::Ref_Type type) {
         Type_Converter::Conversion_Result result;
-        result.memory = std::make_unique<Samp_SDK::Amx_Scoped_Memory>(amx, 1);
-        
-        if (!result.memory || !result.memory->Is_Valid()) {
+        cell* phys_addr = nullptr;
+
+        if (!Amx_Arena::Allocate(amx, 1, result.value, phys_addr)) {
             result.value = 0;
 
             return result;
         }
         
-        cell* phys_addr = result.memory->Get_Phys_Addr();
         *phys_addr = value;
-        result.value = result.memory->Get_Amx_Addr();
         
         result.update_data.parent = parent_obj;
         result.update_data.phys_addr = phys_addr;
@@ -97,6 +97,131 @@ namespace {
 
         return result;
     }
+
+    static thread_local std::string tl_string_scratch;
+    static thread_local std::string tl_convert_scratch;
+
+    Type_Converter::Conversion_Result Create_String(v8::Isolate* isolate, v8::Local<v8::Value> value, AMX* amx, size_t min_size) {
+        Type_Converter::Conversion_Result result;
+        const char* bytes = "";
+        size_t len = 0;
+
+        if (value->IsString()) {
+            v8::Local<v8::String> v8_str = value.As<v8::String>();
+            int length = v8_str->Length();
+            int utf8_length = v8_str->Utf8Length(isolate);
+
+            tl_string_scratch.resize(static_cast<size_t>(utf8_length));
+
+            if (utf8_length == length)
+                v8_str->WriteOneByte(isolate, reinterpret_cast<uint8_t*>(tl_string_scratch.data()), 0, length, v8::String::NO_NULL_TERMINATION);
+            else
+                v8_str->WriteUtf8(isolate, tl_string_scratch.data(), utf8_length, nullptr, v8::String::NO_NULL_TERMINATION | v8::String::REPLACE_INVALID_UTF8);
+
+            bytes = tl_string_scratch.data();
+            len = tl_string_scratch.length();
+
+            if (utf8_length != length && Encoding_Converter::Instance().Is_Enabled()) {
+                Encoding_Converter& converter = Encoding_Converter::Instance();
+
+                tl_convert_scratch.resize(converter.Max_Target_Length(len));
+                len = converter.UTF8_To_Target(tl_string_scratch, tl_convert_scratch.data(), tl_convert_scratch.size());
+                bytes = tl_convert_scratch.data();
+            }
+        }
+
+        size_t buffer_size = std::max<size_t>(min_size, len + 1);
+        cell* phys_addr = nullptr;
+
+        if (!Amx_Arena::Allocate(amx, buffer_size, result.value, phys_addr)) {
+            result.value = 0;
+
+            return result;
+        }
+
+        Simd::Widen_To_Cells(reinterpret_cast<const unsigned char*>(bytes), phys_addr, len);
+        phys_addr[len] = 0;
+
+        result.update_data.phys_addr = phys_addr;
+        result.update_data.size = buffer_size;
+
+        return result;
+    }
+
+    SAMP_SDK_FORCE_INLINE bool Is_Numeric(v8::Local<v8::Value> value) {
+        return value->IsNumber() || value->IsBoolean() || value->IsNumberObject();
+    }
+
+    SAMP_SDK_FORCE_INLINE double Primitive_Number(v8::Local<v8::Value> value) {
+        if (value->IsNumber())
+            return value.As<v8::Number>()->Value();
+
+        if (value->IsNumberObject())
+            return value.As<v8::NumberObject>()->ValueOf();
+
+        if (value->IsBoolean())
+            return value.As<v8::Boolean>()->Value() ? 1.0 : 0.0;
+
+        return 0.0;
+    }
+
+    SAMP_SDK_FORCE_INLINE cell Primitive_Integer(v8::Local<v8::Value> value) {
+        if (value->IsInt32())
+            return value.As<v8::Int32>()->Value();
+
+        return Type_Converter::Number_To_Cell(Primitive_Number(value), Constants::SIGNATURE_TYPE_INTEGER);
+    }
+
+    Type_Converter::Conversion_Result Pointer_To_Cell(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> obj, AMX* amx, Type_Converter::Ref_Type declared) {
+        Type_Converter::Conversion_Result result;
+        v8::Local<v8::Value> parent_val;
+        v8::MaybeLocal<v8::Value> maybe_parent = obj->Get(context, string_cache.parent_field.Get(isolate));
+
+        if (!maybe_parent.ToLocal(&parent_val) || !parent_val->IsObject())
+            return result;
+
+        v8::Local<v8::Object> parent_obj = parent_val.As<v8::Object>();
+        v8::Local<v8::Value> val_prop;
+
+        if (!Fast_Get_Value(isolate, context, parent_obj, val_prop))
+            return result;
+
+        if (declared == Type_Converter::Ref_Type::None) {
+            if (val_prop->IsNumberObject())
+                declared = Type_Converter::Ref_Type::Float;
+            else if (val_prop->IsNumber()) {
+                double num = val_prop->NumberValue(context).FromMaybe(0.0);
+                bool is_float = (num != std::floor(num));
+
+                declared = is_float ? Type_Converter::Ref_Type::Float : Type_Converter::Ref_Type::Int;
+            }
+            else if (val_prop->IsBoolean())
+                declared = Type_Converter::Ref_Type::Bool;
+            else if (val_prop->IsString())
+                declared = Type_Converter::Ref_Type::String;
+            else
+                return result;
+        }
+
+        switch (declared) {
+            case Type_Converter::Ref_Type::Float:
+                return Create_Ref_Struct(parent_obj, Samp_SDK::amx::AMX_FTOC(static_cast<float>(Primitive_Number(val_prop))), amx, declared);
+            case Type_Converter::Ref_Type::Bool:
+                return Create_Ref_Struct(parent_obj, Primitive_Number(val_prop) != 0.0 ? 1 : 0, amx, declared);
+            case Type_Converter::Ref_Type::String: {
+                result = Create_String(isolate, val_prop, amx, Constants::DEFAULT_STRING_BUFFER_SIZE);
+
+                if (result.value != 0) {
+                    result.update_data.parent = parent_obj;
+                    result.update_data.type = declared;
+                }
+
+                return result;
+            }
+            default:
+                return Create_Ref_Struct(parent_obj, Primitive_Integer(val_prop), amx, Type_Converter::Ref_Type::Int);
+        }
+    }
 }
 
 Type_Converter::Conversion_Result Type_Converter::To_Cell(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value, AMX* amx) {
@@ -123,101 +248,107 @@ Type_Converter::Conversion_Result Type_Converter::To_Cell(v8::Isolate* isolate,
 
         return result;
     }
-    
-    if (value->IsString()) {
-        v8::Local<v8::String> v8_str = value.As<v8::String>();
-
-        v8::String::Utf8Value utf8_value(isolate, v8_str);
-        std::string utf8_str(*utf8_value ? *utf8_value : "");
-
-        std::string target_str = Encoding_Converter::Instance().UTF8_To_Target(utf8_str);
-
-        int len = static_cast<int>(target_str.length());
-        result.memory = std::make_unique<Samp_SDK::Amx_Scoped_Memory>(amx, len + 1);
-
-        if (!result.memory || !result.memory->Is_Valid()) {
-            result.value = 0;
-
-            return result;
-        }
-
-        cell* phys_addr = result.memory->Get_Phys_Addr();
-
-        for (int i = 0; i < len; i++)
-            phys_addr[i] = static_cast<cell>(static_cast<unsigned char>(target_str[i]));
-
-        phys_addr[len] = 0;
 
-        result.value = result.memory->Get_Amx_Addr();
+    // 'Float()' boxes its value, which is how integral floats are told apart from integers here.
+    if (value->IsNumberObject()) {
+        result.value = Samp_SDK::amx::AMX_FTOC(static_cast<float>(Primitive_Number(value)));
 
         return result;
     }
     
+    if (value->IsString()) {
+        return Create_String(isolate, value, amx, 0);
+    }
+    
     if (!value->IsObject())
         return result;
     
     v8::Local<v8::Object> obj = value.As<v8::Object>();
     
-    if (Has_Field(isolate, context, obj, string_cache.kainure_ptr_field.Get(isolate))) {
-        v8::Local<v8::Value> parent_val;
-        v8::MaybeLocal<v8::Value> maybe_parent = obj->Get(context, string_cache.parent_field.Get(isolate));
-        
-        if (maybe_parent.ToLocal(&parent_val) && parent_val->IsObject()) {
-            v8::Local<v8::Object> parent_obj = parent_val.As<v8::Object>();
-            v8::Local<v8::Value> val_prop;
-            
-            if (Fast_Get_Value(isolate, context, parent_obj, val_prop)) {
-                if (val_prop->IsNumber()) {
-                    double num = val_prop->NumberValue(context).FromMaybe(0.0);
-                    bool is_float = (num != std::floor(num));
-                    
-                    return Create_Ref_Struct(parent_obj, is_float ? Samp_SDK::amx::AMX_FTOC(static_cast<float>(num)) : static_cast<cell>(num), amx, is_float ? Ref_Type::Float : Ref_Type::Int);
-                }
-                else if (val_prop->IsBoolean())
-                    return Create_Ref_Struct(parent_obj, val_prop->BooleanValue(isolate) ? 1 : 0, amx, Ref_Type::Bool);
-                else if (val_prop->IsString()) {
-                    v8::Local<v8::String> v8_str = val_prop.As<v8::String>();
+    if (Has_Field(isolate, context, obj, string_cache.kainure_ptr_field.Get(isolate)))
+        return Pointer_To_Cell(isolate, context, obj, amx, Ref_Type::None);
+    
+    if (Has_Field(isolate, context, obj, string_cache.kainure_ref_field.Get(isolate))) {
+        v8::Local<v8::Value> val_prop;
 
-                    v8::String::Utf8Value utf8_value(isolate, v8_str);
-                    std::string utf8_str(*utf8_value ? *utf8_value : "");
+        if (Fast_Get_Value(isolate, context, obj, val_prop))
+            return To_Cell(isolate, context, val_prop, amx);
+    }
+    
+    return result;
+}
+
+Type_Converter::Conversion_Result Type_Converter::To_Cell(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value, AMX* amx, char declared_type) {
+    Conversion_Result result;
+
+    switch (declared_type) {
+        case Constants::SIGNATURE_TYPE_INTEGER:
+        case Constants::SIGNATURE_TYPE_BOOL:
+            if (!Is_Numeric(value))
+                break;
 
-                    std::string target_str = Encoding_Converter::Instance().UTF8_To_Target(utf8_str);
+            result.value = Primitive_Integer(value);
 
-                    int len = static_cast<int>(target_str.length());
-                    size_t buffer_size = std::max<size_t>(Constants::DEFAULT_STRING_BUFFER_SIZE, len + 1);
+            return result;
+        case Constants::SIGNATURE_TYPE_FLOAT:
+            if (!Is_Numeric(value))
+                break;
 
-                    result.memory = std::make_unique<Samp_SDK::Amx_Scoped_Memory>(amx, buffer_size);
+            result.value = Samp_SDK::amx::AMX_FTOC(static_cast<float>(Primitive_Number(value)));
 
-                    if (result.memory && result.memory->Is_Valid()) {
-                        cell* phys_addr = result.memory->Get_Phys_Addr();
+            return result;
+        case Constants::SIGNATURE_TYPE_STRING:
+            if (!value->IsString())
+                break;
 
-                        for (int i = 0; i < len; i++)
-                            phys_addr[i] = static_cast<cell>(static_cast<unsigned char>(target_str[i]));
+            return Create_String(isolate, value, amx, 0);
+        case Constants::SIGNATURE_TYPE_INT_REF:
+        case Constants::SIGNATURE_TYPE_FLOAT_REF:
+        case Constants::SIGNATURE_TYPE_STRING_REF: {
+            if (!value->IsObject())
+                break;
 
-                        phys_addr[len] = 0;
+            string_cache.Ensure_Initialized(isolate);
 
-                        result.value = result.memory->Get_Amx_Addr();
-                        result.update_data.parent = parent_obj;
-                        result.update_data.phys_addr = phys_addr;
-                        result.update_data.type = Ref_Type::String;
-                        result.update_data.size = buffer_size;
-                    }
+            v8::Local<v8::Object> obj = value.As<v8::Object>();
 
-                    return result;
-                }
+            if (!Has_Field(isolate, context, obj, string_cache.kainure_ptr_field.Get(isolate)))
+                break;
 
-            }
+            Ref_Type declared = declared_type == Constants::SIGNATURE_TYPE_FLOAT_REF ? Ref_Type::Float : declared_type == Constants::SIGNATURE_TYPE_STRING_REF ? Ref_Type::String : Ref_Type::Int;
+
+            return Pointer_To_Cell(isolate, context, obj, amx, declared);
         }
+        default:
+            break;
     }
-    
-    if (Has_Field(isolate, context, obj, string_cache.kainure_ref_field.Get(isolate))) {
-        v8::Local<v8::Value> val_prop;
 
-        if (Fast_Get_Value(isolate, context, obj, val_prop))
-            return To_Cell(isolate, context, val_prop, amx);
+    return To_Cell(isolate, context, value, amx);
+}
+
+cell Type_Converter::Number_To_Cell(double value, char declared_type) {
+    switch (declared_type) {
+        case Constants::SIGNATURE_TYPE_FLOAT:
+            return Samp_SDK::amx::AMX_FTOC(static_cast<float>(value));
+        case Constants::SIGNATURE_TYPE_INTEGER:
+        case Constants::SIGNATURE_TYPE_BOOL:
+            return std::isfinite(value) ? static_cast<cell>(static_cast<int64_t>(std::trunc(std::fmod(value, 4294967296.0)))) : 0;
+        default:
+            if (value >= INT32_MIN && value <= INT32_MAX && value == std::trunc(value))
+                return static_cast<cell>(value);
+
+            return Samp_SDK::amx::AMX_FTOC(static_cast<float>(value));
     }
-    
-    return result;
+}
+
+v8::Local<v8::Value> Type_Converter::From_Native_Return(v8::Isolate* isolate, cell value, char return_type) {
+    if (return_type == Constants::SIGNATURE_TYPE_FLOAT)
+        return v8::Number::New(isolate, Samp_SDK::amx::AMX_CTOF(value));
+
+    if (return_type == Constants::SIGNATURE_TYPE_BOOL)
+        return v8::Boolean::New(isolate, value != 0);
+
+    return v8::Integer::New(isolate, value);
 }
 
 void Type_Converter::Apply_Updates(v8::Isolate* isolate, v8::Local<v8::Context> context, const Ref_Update_Data* updates, size_t count) {
@@ -249,17 +380,20 @@ void Type_Converter::Apply_Updates(v8::Isolate* isolate, v8::Local<v8::Context>
 
                 break;
             case Ref_Type::String: {
-                std::string target_str(data.size, '\0');
-                Samp_SDK::amx::Get_String(&target_str[0], data.phys_addr, data.size);
+                Encoding_Converter& converter = Encoding_Converter::Instance();
+
+                tl_string_scratch.resize(data.size);
+                Samp_SDK::amx::Get_String(tl_string_scratch.data(), data.phys_addr, data.size);
 
-                size_t null_pos = target_str.find('\0');
+                size_t null_pos = tl_string_scratch.find('\0');
 
                 if (null_pos != std::string::npos)
-                    target_str.resize(null_pos);
+                    tl_string_scratch.resize(null_pos);
 
-                std::string utf8_str = Encoding_Converter::Instance().Target_To_UTF8(target_str);
+                tl_convert_scratch.resize(converter.Max_UTF8_Length(tl_string_scratch.length()));
+                size_t utf8_len = converter.Target_To_UTF8(tl_string_scratch, tl_convert_scratch.data(), tl_convert_scratch.size());
 
-                data.parent->Set(context, val_field, v8::String::NewFromUtf8(isolate, utf8_str.c_str(), v8::NewStringType::kNormal).ToLocalChecked()).Check();
+                data.parent->Set(context, val_field, v8::String::NewFromUtf8(isolate, tl_convert_scratch.data(), v8::NewStringType::kNormal, static_cast<int>(utf8_len)).ToLocalChecked()).Check();
 
                 break;
             }
@@ -269,6 +403,60 @@ void Type_Converter::Apply_Updates(v8::Isolate* isolate, v8::Local<v8::Context>
     }
 }
 
+size_t Type_Converter::Bind_Typed_Outputs(v8::Local<v8::TypedArray> array, const char* types, size_t max_slots, AMX* amx, cell* params, Typed_Output* outputs) {
+    bool element_is_float = array->IsFloat32Array();
+
+    if (!element_is_float && !array->IsInt32Array())
+        return 0;
+
+    size_t count = 0;
+    size_t length = array->Length();
+
+    while (count < length && count < max_slots && (types[count] == Constants::SIGNATURE_TYPE_INT_REF || types[count] == Constants::SIGNATURE_TYPE_FLOAT_REF))
+        ++count;
+
+    cell amx_addr = 0;
+    cell* phys_addr = nullptr;
+
+    if (count == 0 || !Amx_Arena::Allocate(amx, count, amx_addr, phys_addr))
+        return 0;
+
+    uint8_t* elements = static_cast<uint8_t*>(array->Buffer()->Data()) + array->ByteOffset();
+
+    for (size_t i = 0; i < count; i++) {
+        Typed_Output& output = outputs[i];
+
+        output.element = elements + i * sizeof(int32_t);
+        output.phys_addr = phys_addr + i;
+        output.slot_is_float = types[i] == Constants::SIGNATURE_TYPE_FLOAT_REF;
+        output.element_is_float = element_is_float;
+
+        if (output.slot_is_float == element_is_float)
+            std::memcpy(output.phys_addr, output.element, sizeof(cell));
+        else if (element_is_float)
+            *output.phys_addr = static_cast<cell>(*static_cast<const float*>(output.element));
+        else
+            *output.phys_addr = Samp_SDK::amx::AMX_FTOC(static_cast<float>(*static_cast<const int32_t*>(output.element)));
+
+        params[i] = amx_addr + static_cast<cell>(i * sizeof(cell));
+    }
+
+    return count;
+}
+
+void Type_Converter::Apply_Typed_Outputs(const Typed_Output* outputs, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        const Typed_Output& output = outputs[i];
+
+        if (output.slot_is_float == output.element_is_float)
+            std::memcpy(output.element, output.phys_addr, sizeof(cell));
+        else if (output.element_is_float)
+            *static_cast<float*>(output.element) = static_cast<float>(*output.phys_addr);
+        else
+            *static_cast<int32_t*>(output.element) = static_cast<int32_t>(Samp_SDK::amx::AMX_CTOF(*output.phys_addr));
+    }
+}
+
 cell Type_Converter::To_Return_Code(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> js_value) {
     if (js_value.IsEmpty() || js_value->IsUndefined() || js_value->IsNull())
         return PUBLIC_CONTINUE;
@@ -33,10 +33,9 @@
 #pragma once
 
 #include <cstdint>
-#include <memory>
+#include <cstddef>
 //
 #include "sdk/amx/amx_defs.h"
-#include "sdk/amx/amx_memory.hpp"
 //
 #include "node_inclusion.hpp"
 
@@ -59,7 +58,6 @@ class Type_Converter {
 
         struct Conversion_Result {
             cell value = 0;
-            std::unique_ptr<Samp_SDK::Amx_Scoped_Memory> memory;
             Ref_Update_Data update_data;
 
             Conversion_Result() : value(0), update_data{ {}, nullptr, Ref_Type::None, 0 } {}
@@ -69,7 +67,19 @@ class Type_Converter {
             }
         };
 
+        struct Typed_Output {
+            void* element = nullptr;
+            cell* phys_addr = nullptr;
+            bool slot_is_float = false;
+            bool element_is_float = false;
+        };
+
         static Conversion_Result To_Cell(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value, AMX* amx);
+        static Conversion_Result To_Cell(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value, AMX* amx, char declared_type);
+        static cell Number_To_Cell(double value, char declared_type);
+        static v8::Local<v8::Value> From_Native_Return(v8::Isolate* isolate, cell value, char return_type);
         static cell To_Return_Code(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> js_value);
         static void Apply_Updates(v8::Isolate* isolate, v8::Local<v8::Context> context, const Ref_Update_Data* updates, size_t count);
+        static size_t Bind_Typed_Outputs(v8::Local<v8::TypedArray> array, const char* types, size_t max_slots, AMX* amx, cell* params, Typed_Output* outputs);
+        static void Apply_Typed_Outputs(const Typed_Output* outputs, size_t count);
 };
@@ -43,6 +43,82 @@
 
 namespace fs = std::filesystem;
 
+namespace {
+    // Spliced into both the compiler script and the type check worker, which only receives its entry function's source.
+    constexpr const char* JS_TS_HELPERS = R"(
+        function Read_TS_Config(ts, path, tsconfig_path) {
+            const format_host = {
+                getCanonicalFileName: f => f,
+                getCurrentDirectory: ts.sys.getCurrentDirectory,
+                getNewLine: () => '\n'
+            };
+
+            const config_file = ts.readConfigFile(tsconfig_path, ts.sys.readFile);
+
+            if (config_file.error)
+                throw new Error('Error reading tsconfig.json:\n' + ts.formatDiagnostics([config_file.error], format_host));
+
+            const parsed_config = ts.parseJsonConfigFileContent(
+                config_file.config,
+                ts.sys,
+                path.dirname(tsconfig_path)
+            );
+
+            if (parsed_config.errors.length > 0)
+                throw new Error('Error parsing tsconfig.json content:\n' + ts.formatDiagnostics(parsed_config.errors, format_host));
+
+            return parsed_config;
+        }
+
+        function Build_TS_Program(ts, parsed_config, build_info_file) {
+            parsed_config.options.incremental = true;
+            parsed_config.options.tsBuildInfoFile = build_info_file;
+
+            // Reuses the previous build info, so unchanged files keep their cached diagnostics and are not emitted again.
+            const program = ts.createIncrementalProgram({
+                rootNames: parsed_config.fileNames,
+                options: parsed_config.options,
+                configFileParsingDiagnostics: ts.getConfigFileParsingDiagnostics(parsed_config),
+                projectReferences: parsed_config.projectReferences
+            });
+
+            const diagnostics = [
+                ...program.getConfigFileParsingDiagnostics(),
+                ...program.getOptionsDiagnostics(),
+                ...program.getGlobalDiagnostics(),
+                ...program.getSyntacticDiagnostics(),
+                ...program.getSemanticDiagnostics()
+            ];
+
+            return { program, diagnostics };
+        }
+
+        function Split_TS_Diagnostics(ts, diagnostics) {
+            const errors = [];
+            const warnings = [];
+
+            diagnostics.forEach(diagnostic => {
+                const message = ts.flattenDiagnosticMessageText(diagnostic.messageText, '\n');
+                let formatted_message = '';
+
+                if (diagnostic.file && diagnostic.start !== undefined) {
+                    const { line, character } = diagnostic.file.getLineAndCharacterOfPosition(diagnostic.start);
+                    formatted_message = `${diagnostic.file.fileName} (${line + 1},${character + 1}): ${message}`;
+                }
+                else
+                    formatted_message = message;
+
+                if (diagnostic.category === ts.DiagnosticCategory.Error)
+                    errors.push(formatted_message);
+                else if (diagnostic.category === ts.DiagnosticCategory.Warning)
+                    warnings.push(formatted_message);
+            });
+
+            return { errors, warnings };
+        }
+    )";
+}
+
 TypeScript_Compiler& TypeScript_Compiler::Instance() {
     static TypeScript_Compiler instance;
 
@@ -141,9 +217,13 @@ bool TypeScript_Compiler::Execute_TypeScript_Compiler(v8::Isolate* isolate, v8::
         if (context.IsEmpty())
             throw V8_Exception("Context is empty in 'Execute_TypeScript_Compiler'.");
 
-        Logger::Log(Log_Level::INFO, "Compiling TypeScript project...");
-
         const auto& config = File_Manager::Instance().Get_Config();
+
+        if (config.ts_mode == Constants::TS_MODE_TRANSPILE)
+            Logger::Log(Log_Level::INFO, "Transpiling TypeScript project (type-checking skipped)...");
+        else
+            Logger::Log(Log_Level::INFO, "Compiling TypeScript project...");
+
         std::string output_dir = config.ts_output_dir.empty() ? Constants::DEFAULT_TS_OUT_DIR : config.ts_output_dir;
 
         try {
@@ -169,12 +249,98 @@ bool TypeScript_Compiler::Execute_TypeScript_Compiler(v8::Isolate* isolate, v8::
                 c = '/';
         }
 
+        std::string emit_code;
+
+        if (config.ts_mode == Constants::TS_MODE_TRANSPILE) {
+            emit_code = R"(
+                    // Each file is compiled without seeing the others, so constructs that need the whole program are reported instead.
+                    parsed_config.options.isolatedModules = true;
+
+                    const root_dir = path.resolve(parsed_config.options.rootDir);
+                    const config_time = fs.statSync(tsconfig_path).mtimeMs;
+                    const all_diagnostics = [];
+                    // Outputs are only fresh if they came from the same compiler and options, which file times alone cannot tell.
+                    const stamp_file = path.join(forced_out_dir, ')" + std::string(Constants::TS_TRANSPILE_STAMP_FILE) + R"(');
+                    const stamp = ts.version + '\n' + JSON.stringify(parsed_config.options);
+                    let stamp_matches = false;
+
+                    try {
+                        stamp_matches = fs.readFileSync(stamp_file, 'utf8') === stamp;
+                    }
+                    catch {}
+
+                    for (const file_name of parsed_config.fileNames) {
+                        if (file_name.endsWith('.d.ts'))
+                            continue;
+
+                        const out_file = path.join(forced_out_dir, path.relative(root_dir, file_name)).replace(/\.([cm]?)tsx?$/, '.$1js');
+
+                        if (stamp_matches && fs.existsSync(out_file) && fs.statSync(out_file).mtimeMs >= Math.max(fs.statSync(file_name).mtimeMs, config_time))
+                            continue;
+
+                        const output = ts.transpileModule(fs.readFileSync(file_name, 'utf8'), {
+                            compilerOptions: parsed_config.options,
+                            fileName: file_name,
+                            reportDiagnostics: true
+                        });
+
+                        all_diagnostics.push(...output.diagnostics);
+
+                        // Left unwritten so the file is transpiled, and its errors reported, again on the next boot.
+                        if (output.diagnostics.some(diagnostic => diagnostic.category === ts.DiagnosticCategory.Error))
+                            continue;
+
+                        fs.mkdirSync(path.dirname(out_file), { recursive: true });
+                        fs.writeFileSync(out_file, output.outputText);
+
+                        if (output.sourceMapText)
+                            fs.writeFileSync(out_file + '.map', output.sourceMapText);
+                    }
+
+                    // Left unwritten while any file has errors, so outputs from a previous compiler are all redone on the next boot.
+                    if (!all_diagnostics.some(diagnostic => diagnostic.category === ts.DiagnosticCategory.Error))
+                        fs.writeFileSync(stamp_file, stamp);
+            )";
+        }
+        else {
+            emit_code = R"(
+                    const build_info_file = path.join(forced_out_dir, ')" + std::string(Constants::TS_BUILD_INFO_FILE) + R"(');
+                    const root_dir = path.resolve(parsed_config.options.rootDir);
+                    const options = parsed_config.options;
+
+                    function Has_Outputs(file_name) {
+                        const match = /\.([cm]?)tsx?$/.exec(file_name);
+
+                        if (!match || /\.d\.[cm]?ts$/.test(file_name))
+                            return true;
+
+                        const relative = path.relative(root_dir, file_name).slice(0, -match[0].length);
+                        const script_file = path.join(forced_out_dir, relative) + '.' + match[1] + 'js';
+                        const declaration_file = path.join(options.declarationDir || forced_out_dir, relative) + '.d.' + match[1] + 'ts';
+
+                        return (options.emitDeclarationOnly || (fs.existsSync(script_file) && (!options.sourceMap || fs.existsSync(script_file + '.map')))) &&
+                            (!options.declaration || fs.existsSync(declaration_file));
+                    }
+
+                    // The build info only tracks sources, so an emitted file deleted by hand would never come back unless the build starts over.
+                    if (!options.noEmit && fs.existsSync(build_info_file) && !parsed_config.fileNames.every(Has_Outputs)) {
+                        console.log(`Compiled output is missing. Discarding '${path.basename(build_info_file)}' for a full rebuild.`);
+                        fs.rmSync(build_info_file, { force: true });
+                    }
+
+                    const { program, diagnostics } = Build_TS_Program(ts, parsed_config, build_info_file);
+                    const emit_result = program.emit();
+                    const all_diagnostics = diagnostics.concat(emit_result.diagnostics);
+            )";
+        }
+
         std::string compile_code = R"(
             (function() {
                 const ts = require('typescript');
                 const fs = require('fs');
                 const path = require('path');
-        
+                )" + std::string(JS_TS_HELPERS) + R"(
+
                 try {
                     const tsconfig_path = ')" + safe_tsconfig + R"(';
                     const forced_out_dir = ')" + safe_output_dir + R"(';
@@ -182,78 +348,21 @@ bool TypeScript_Compiler::Execute_TypeScript_Compiler(v8::Isolate* isolate, v8::
                     if (!fs.existsSync(tsconfig_path))
                         throw new Error('tsconfig.json not found at: ' + tsconfig_path);
 
-                    const config_file = ts.readConfigFile(tsconfig_path, ts.sys.readFile);
-
-                    if (config_file.error) {
-                         const error = ts.formatDiagnostics([config_file.error], {
-                            getCanonicalFileName: f => f,
-                            getCurrentDirectory: ts.sys.getCurrentDirectory,
-                            getNewLine: () => '\n'
-                        });
-
-                        throw new Error('Error reading tsconfig.json:\n' + error);
-                    }
-
-                    const parsed_config = ts.parseJsonConfigFileContent(
-                        config_file.config,
-                        ts.sys,
-                        path.dirname(tsconfig_path)
-                    );
-
-                    if (parsed_config.errors.length > 0) {
-                        const errors = ts.formatDiagnostics(parsed_config.errors, {
-                            getCanonicalFileName: f => f,
-                            getCurrentDirectory: ts.sys.getCurrentDirectory,
-                            getNewLine: () => '\n'
-                        });
-
-                        throw new Error('Error parsing tsconfig.json content:\n' + errors);
-                    }
+                    const parsed_config = Read_TS_Config(ts, path, tsconfig_path);
 
                     parsed_config.options.outDir = forced_out_dir;
                     
                     if (!parsed_config.options.rootDir)
                         parsed_config.options.rootDir = './';
+                    )" + emit_code + R"(
+                    const { errors, warnings } = Split_TS_Diagnostics(ts, all_diagnostics);
+
+                    if (errors.length > 0)
+                        throw new Error('TypeScript compilation failed with errors:\n' + errors.join('\n'));
 
-                    const program = ts.createProgram(parsed_config.fileNames, parsed_config.options);
-                    const emit_result = program.emit();
-                    const all_diagnostics = ts.getPreEmitDiagnostics(program).concat(emit_result.diagnostics);
-            
-                    if (all_diagnostics.length > 0) {
-                        const errors = [];
-                        const warnings = [];
-                
-                        all_diagnostics.forEach(diagnostic => {
-                            const message = ts.flattenDiagnosticMessageText(diagnostic.messageText, '\n');
-                            let formatted_message = '';
-                    
-                            if (diagnostic.file && diagnostic.start !== undefined) {
-                                const { line, character } = diagnostic.file.getLineAndCharacterOfPosition(diagnostic.start);
-                                formatted_message = `${diagnostic.file.fileName} (${line + 1},${character + 1}): ${message}`;
-                            }
-                            else
-                                formatted_message = message;
-
-                            if (diagnostic.category === ts.DiagnosticCategory.Error)
-                                errors.push(formatted_message);
-                            else if (diagnostic.category === ts.DiagnosticCategory.Warning)
-                                warnings.push(formatted_message);
-                        });
-                
-                        if (errors.length > 0)
-                            throw new Error('TypeScript compilation failed with errors:\n' + errors.join('\n'));
-                
-                        if (warnings.length > 0) {
-                            return {
-                                success: true,
-                                warnings: warnings
-                            };
-                        }
-                    }
-            
                     return {
                         success: true,
-                        warnings: []
+                        warnings: warnings
                     };
                 }
                 catch (error) {
@@ -320,6 +429,252 @@ bool TypeScript_Compiler::Execute_TypeScript_Compiler(v8::Isolate* isolate, v8::
     }
 }
 
+bool TypeScript_Compiler::Install_Require_Hook(v8::Isolate* isolate, v8::Local<v8::Context> context) {
+    try {
+        Logger::Log(Log_Level::INFO, "Installing on-demand TypeScript loader (type-checking skipped)...");
+
+        std::string hook_code = R"(
+            (function() {
+                const ts = require('typescript');
+                const fs = require('fs');
+                const path = require('path');
+                const crypto = require('crypto');
+                const _module = require('module');
+                )" + std::string(JS_TS_HELPERS) + R"(
+
+                const tsconfig_path = path.resolve(')" + std::string(Constants::FILE_TSCONFIG) + R"(');
+
+                if (!fs.existsSync(tsconfig_path))
+                    throw new Error('tsconfig.json not found at: ' + tsconfig_path);
+
+                const parsed_config = Read_TS_Config(ts, path, tsconfig_path);
+                const use_source_maps = !!(parsed_config.options.sourceMap || parsed_config.options.inlineSourceMap);
+
+                // The output goes straight into '_compile', so it has to be CommonJS and carry any source map inline.
+                // Each file is compiled without seeing the others, so constructs that need the whole program are reported instead.
+                const compiler_options = Object.assign({}, parsed_config.options, {
+                    module: ts.ModuleKind.CommonJS,
+                    isolatedModules: true,
+                    declaration: false,
+                    declarationMap: false,
+                    sourceMap: false,
+                    inlineSourceMap: use_source_maps,
+                    inlineSources: use_source_maps,
+                    noEmit: false
+                });
+
+                if (use_source_maps)
+                    process.setSourceMapsEnabled(true);
+
+                const cache_dir = path.resolve(')" + std::string(Constants::DIR_TS_CACHE) + R"(');
+                const memory_cache = new Map();
+                // Output also depends on the compiler and its options, so both are hashed in front of the source.
+                const key_prefix = ts.version + '\0' + JSON.stringify(compiler_options) + '\0';
+
+                const max_age_ms = )" + std::to_string(Constants::TS_CACHE_MAX_AGE_DAYS) + R"( * 24 * 60 * 60 * 1000;
+                const cached_entries = [];
+
+                fs.mkdirSync(cache_dir, { recursive: true });
+
+                // Entries are touched whenever they are read, so only those no boot has needed for a while are aged out.
+                for (const entry of fs.readdirSync(cache_dir)) {
+                    try {
+                        if (Date.now() - fs.statSync(path.join(cache_dir, entry)).mtimeMs > max_age_ms)
+                            fs.unlinkSync(path.join(cache_dir, entry));
+                        else
+                            cached_entries.push(entry);
+                    }
+                    catch {}
+                }
+
+                function Transpile(source, filename) {
+                    const key = crypto.createHash('sha1').update(key_prefix).update(source).digest('hex');
+                    let code = memory_cache.get(key);
+
+                    if (code !== undefined)
+                        return code;
+
+                    // Named after the source file too, so a new version of a file evicts the entries of its older ones.
+                    const file_prefix = crypto.createHash('sha1').update(filename).digest('hex').slice(0, 16) + '-';
+                    const cache_name = file_prefix + key + ')" + std::string(Constants::JS_EXTENSION) + R"(';
+                    const cache_file = path.join(cache_dir, cache_name);
+
+                    try {
+                        code = fs.readFileSync(cache_file, 'utf8');
+
+                        const now = new Date();
+                        fs.utimesSync(cache_file, now, now);
+                    }
+                    catch {
+                        const output = ts.transpileModule(source, {
+                            compilerOptions: compiler_options,
+                            fileName: filename,
+                            reportDiagnostics: true
+                        });
+
+                        const { errors, warnings } = Split_TS_Diagnostics(ts, output.diagnostics);
+
+                        if (errors.length > 0)
+                            throw new Error('TypeScript transpilation failed with errors:\n' + errors.join('\n'));
+
+                        warnings.forEach(warning => console.warn(warning));
+                        code = output.outputText;
+
+                        // Written aside and renamed, so a crash mid-write never leaves a truncated entry behind.
+                        const temp_file = cache_file + '.' + process.pid + '.tmp';
+
+                        try {
+                            fs.writeFileSync(temp_file, code);
+                            fs.renameSync(temp_file, cache_file);
+                        }
+                        catch (error) {
+                            console.warn(`Could not cache transpiled '${filename}': ${error.message}`);
+                        }
+
+                        for (const entry of cached_entries) {
+                            if (entry.startsWith(file_prefix) && entry !== cache_name)
+                                fs.rmSync(path.join(cache_dir, entry), { force: true });
+                        }
+                    }
+
+                    memory_cache.set(key, code);
+
+                    return code;
+                }
+
+                _module._extensions[')" + std::string(Constants::TS_EXTENSION) + R"('] = function(module, filename) {
+                    module._compile(Transpile(fs.readFileSync(filename, 'utf8'), filename), filename);
+                };
+
+                return true;
+            })()
+        )";
+
+        v8::TryCatch try_catch(isolate);
+        v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, hook_code.c_str()).ToLocalChecked();
+        v8::ScriptOrigin origin(isolate, v8::String::NewFromUtf8(isolate, Constants::TS_REQUIRE_HOOK_SCRIPT_NAME).ToLocalChecked());
+        v8::MaybeLocal<v8::Script> script = v8::Script::Compile(context, source, &origin);
+
+        if (script.IsEmpty()) {
+            Error_Handler::Log_Exception(isolate, try_catch);
+
+            throw Script_Exception("Failed to compile TypeScript require hook script.");
+        }
+
+        if (script.ToLocalChecked()->Run(context).IsEmpty()) {
+            Error_Handler::Log_Exception(isolate, try_catch);
+
+            throw TypeScript_Exception("Failed to install TypeScript require hook.");
+        }
+
+        Logger::Log(Log_Level::INFO, "TypeScript files will be transpiled on first 'require'.");
+
+        return true;
+    }
+    catch (const Plugin_Exception& e) {
+        return (Logger::Log(Log_Level::ERROR_s, "'%s'.", e.what()), false);
+    }
+    catch (const std::exception& e) {
+        return (Logger::Log(Log_Level::ERROR_s, "Unexpected error installing TypeScript require hook: '%s'.", e.what()), false);
+    }
+}
+
+void TypeScript_Compiler::Start_Background_Type_Check(v8::Isolate* isolate, v8::Local<v8::Context> context) {
+    const auto& config = File_Manager::Instance().Get_Config();
+    std::string output_dir = config.ts_output_dir.empty() ? Constants::DEFAULT_TS_OUT_DIR : config.ts_output_dir;
+
+    std::replace(output_dir.begin(), output_dir.end(), '\\', '/');
+
+    v8::TryCatch try_catch(isolate);
+
+    context->Global()->Set(context, v8::String::NewFromUtf8(isolate, Constants::JS_REPORT_TYPE_CHECK).ToLocalChecked(), v8::Function::New(context, JS_Report_Type_Check).ToLocalChecked()).Check();
+
+    // The worker is unreferenced, so neither the server tick nor shutdown ever waits for it.
+    std::string check_code = R"(
+        (function() {
+            const { Worker } = require('worker_threads');
+            const path = require('path');
+
+            function Type_Check() {
+                const { parentPort, workerData } = require('worker_threads');
+                const ts = require(workerData.typescript_path);
+                const path = require('path');
+                )" + std::string(JS_TS_HELPERS) + R"(
+
+                const parsed_config = Read_TS_Config(ts, path, workerData.tsconfig_path);
+                parsed_config.options.noEmit = true;
+                // The running code was transpiled one file at a time, so the check also flags what that cannot compile correctly.
+                parsed_config.options.isolatedModules = true;
+
+                const { program, diagnostics } = Build_TS_Program(ts, parsed_config, workerData.build_info_file);
+
+                // With 'noEmit' set, this only writes the build info for the next check.
+                program.emit();
+                parentPort.postMessage(Split_TS_Diagnostics(ts, diagnostics));
+            }
+
+            const worker = new Worker(`(${Type_Check})()`, {
+                eval: true,
+                workerData: {
+                    typescript_path: require.resolve('typescript'),
+                    tsconfig_path: path.resolve(')" + std::string(Constants::FILE_TSCONFIG) + R"('),
+                    build_info_file: path.resolve(')" + output_dir + R"(', ')" + std::string(Constants::TS_CHECK_BUILD_INFO_FILE) + R"(')
+                }
+            });
+
+            worker.on('message', (result) => globalThis.)" + std::string(Constants::JS_REPORT_TYPE_CHECK) + R"((result.errors, result.warnings));
+            worker.on('error', (error) => globalThis.)" + std::string(Constants::JS_REPORT_TYPE_CHECK) + R"(([`Type check worker failed: ${error.message}`], []));
+            worker.unref();
+        })()
+    )";
+
+    v8::Local<v8::String> source = v8::String::NewFromUtf8(isolate, check_code.c_str()).ToLocalChecked();
+    v8::ScriptOrigin origin(isolate, v8::String::NewFromUtf8(isolate, Constants::TS_TYPE_CHECK_SCRIPT_NAME).ToLocalChecked());
+    v8::Local<v8::Script> script;
+
+    if (!v8::Script::Compile(context, source, &origin).ToLocal(&script) || script->Run(context).IsEmpty()) {
+        Logger::Log(Log_Level::WARNING, "Failed to start background type check.");
+        Error_Handler::Log_Exception(isolate, try_catch);
+
+        return;
+    }
+
+    Logger::Log(Log_Level::INFO, "Type-checking TypeScript project in the background...");
+}
+
+void TypeScript_Compiler::JS_Report_Type_Check(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+    auto Log_Messages = [&](v8::Local<v8::Value> value, Log_Level level, const char* label) {
+        if (!value->IsArray())
+            return 0u;
+
+        v8::Local<v8::Array> messages = value.As<v8::Array>();
+        uint32_t count = messages->Length();
+
+        if (count > 0)
+            Logger::Log(level, "Background type check found '%u' %s(s):", count, label);
+
+        for (uint32_t i = 0; i < count; i++) {
+            v8::Local<v8::Value> message_val;
+
+            if (messages->Get(context, i).ToLocal(&message_val) && message_val->IsString()) {
+                v8::String::Utf8Value message_str(isolate, message_val);
+                Logger::Log(level, "   > %s", *message_str);
+            }
+        }
+
+        return count;
+    };
+
+    uint32_t errors = Log_Messages(info[0], Log_Level::ERROR_s, "error");
+    uint32_t warnings = Log_Messages(info[1], Log_Level::WARNING, "warning");
+
+    if (errors == 0 && warnings == 0)
+        Logger::Log(Log_Level::INFO, "Background type check completed with no issues.");
+}
+
 bool TypeScript_Compiler::Compile_Project(v8::Isolate* isolate, v8::Local<v8::Context> context) {
     try {
         bool is_installed = Check_TypeScript_Installation(isolate, context);
@@ -333,7 +688,19 @@ bool TypeScript_Compiler::Compile_Project(v8::Isolate* isolate, v8::Local<v8::Co
             throw TypeScript_Exception("TypeScript module not found.");
         }
 
-        return Execute_TypeScript_Compiler(isolate, context);
+        const auto& config = File_Manager::Instance().Get_Config();
+
+        if (config.ts_mode == Constants::TS_MODE_ON_DEMAND) {
+            if (!Install_Require_Hook(isolate, context))
+                return false;
+        }
+        else if (!Execute_TypeScript_Compiler(isolate, context))
+            return false;
+
+        if (config.ts_mode != Constants::TS_MODE_CHECK && config.ts_background_check)
+            Start_Background_Type_Check(isolate, context);
+
+        return true;
     }
     catch (const TypeScript_Exception& e) {
         return (Logger::Log(Log_Level::ERROR_s, "'%s'.", e.what()), false);
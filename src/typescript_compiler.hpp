@@ -54,4 +54,8 @@ class TypeScript_Compiler {
         bool Check_TypeScript_Installation(v8::Isolate* isolate, v8::Local<v8::Context> context);
         bool Install_TypeScript_Automatically(v8::Isolate* isolate, v8::Local<v8::Context> context);
         bool Execute_TypeScript_Compiler(v8::Isolate* isolate, v8::Local<v8::Context> context);
+        bool Install_Require_Hook(v8::Isolate* isolate, v8::Local<v8::Context> context);
+        void Start_Background_Type_Check(v8::Isolate* isolate, v8::Local<v8::Context> context);
+
+        static void JS_Report_Type_Check(const v8::FunctionCallbackInfo<v8::Value>& info);
 };
\ No newline at end of file